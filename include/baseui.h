@@ -78,6 +78,14 @@ public:
 	 */
 	virtual void UpdateDisplay() = 0;
 
+	/**
+	 * Updates the given area of the video buffer.
+	 * Updates the whole buffer by default.
+	 *
+	 * @param rect changed area, empty when nothing changed.
+	 */
+	virtual void UpdateDisplay(Rect const& rect);
+
 	/**
 	 * Sets display title.
 	 *
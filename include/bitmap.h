@@ -19,6 +19,7 @@
 #define _BITMAP_H_
 
 #include <string>
+#include <vector>
 
 #include <boost/container/vector.hpp>
 #include <boost/operators.hpp>
@@ -31,7 +32,8 @@
 
 class Tone;
 struct Matrix;
-union pixman_image;
+struct pixman_color;
+namespace ImageIO { struct Image; }
 
 struct BlitCommon {
 	BlitCommon(int x_, int y_, Bitmap const& src_, Rect const& src_rect_)
@@ -42,14 +44,18 @@ struct BlitCommon {
 	Rect src_rect;
 };
 
-typedef std::shared_ptr<pixman_image> pixman_image_ptr;
-
 class Bitmap : public boost::equality_comparable<Bitmap> {
   public:
 	static BitmapRef Create(std::string const& file, bool transparent = true);
 	static BitmapRef Create(size_t width, size_t height, Color const& col = Color(0, 0, 0, 0));
 	static BitmapRef Create(BitmapRef const& another);
 	static BitmapRef Create(uint8_t const* data, size_t data_size, bool transparent = true);
+	/**
+	 * Creates bitmap taking the pixels of a decoded image without copying.
+	 *
+	 * @param img decoded image, its pixels are left empty.
+	 */
+	static BitmapRef Create(ImageIO::Image& img);
 
 	size_t width() const;
 	size_t height() const;
@@ -57,13 +63,30 @@ class Bitmap : public boost::equality_comparable<Bitmap> {
 	Rect rect() const;
 
 	void blit(int x, int y, Bitmap const& src, Rect const& src_rect, int opacity = 255);
+	void over_blit(int x, int y, Bitmap const& src, Rect const& src_rect);
 	void fill(Rect const& rect, Color const& col);
 
 	void clear();
+	void clear(Rect const& rect);
+
+	/**
+	 * Restricts drawing to the given rects.
+	 *
+	 * @param rects clip rects, empty to disable clipping.
+	 */
+	void set_clip_rects(std::vector<Rect> const& rects);
 
 	Color const& get_pixel(int x, int y) const;
 	void set_pixel(int x, int y, Color const& col);
 
+	/**
+	 * Gets a whole row for bulk reading without per pixel checks.
+	 *
+	 * @param y row inside the bitmap.
+	 * @return width() pixels.
+	 */
+	Color const* row(int y) const;
+
 	void hue_change(int hue);
 
 	void draw_text(int x, int y, std::string const& str, Text::Alignment aln = Text::AlignLeft);
@@ -99,6 +122,14 @@ class Bitmap : public boost::equality_comparable<Bitmap> {
 
 	bool clear_dirty_flag();
 
+	/**
+	 * Gets content generation.
+	 * Unique among all bitmaps and renewed on each modification.
+	 *
+	 * @return generation.
+	 */
+	uint32_t generation() const;
+
 	pixman_image* image();
 
 	bool operator==(Bitmap const& rhs) const;
@@ -109,6 +140,7 @@ class Bitmap : public boost::equality_comparable<Bitmap> {
   private:
 	Bitmap(size_t width, size_t height, Color const& col);
 	Bitmap(Bitmap const& bmp);
+	Bitmap(ImageIO::Image& img);
 
 	void mark_dirty();
 
@@ -129,10 +161,20 @@ class Bitmap : public boost::equality_comparable<Bitmap> {
 
   private:
 	bool dirty_;
+	bool clipped_;
+	uint32_t generation_;
 	size_t const width_, height_;
 	boost::container::vector<Color> data_;
 
 	pixman_image_ptr const ref_;
 };
 
+/**
+ * Converts color to the 16 bits per channel color of pixman.
+ *
+ * @param c color.
+ * @return pixman_color_t.
+ */
+pixman_color to_pixman(Color const& c);
+
 #endif
@@ -24,6 +24,8 @@
 #include "color.h"
 #include "memory_management.h"
 
+struct DrawState;
+
 /**
  * Base BitmapScreen class.
  *
@@ -91,6 +93,27 @@ public:
 	 */
 	void BlitScreenTiled(Rect const& src_rect, Rect const& dst_rect, int ox, int oy);
 
+	/**
+	 * Adds what BlitScreen would draw to a drawable state.
+	 *
+	 * @param x x position.
+	 * @param y y position.
+	 * @param src_rect source rect.
+	 * @param state state of the drawable.
+	 */
+	void GetDrawState(int x, int y, Rect const& src_rect, DrawState& state) const;
+
+	/**
+	 * Adds what BlitScreenTiled would draw to a drawable state.
+	 *
+	 * @param src_rect source bitmap rect.
+	 * @param dst_rect screen destination rect.
+	 * @param ox tile start x offset.
+	 * @param oy tile start y offset.
+	 * @param state state of the drawable.
+	 */
+	void GetDrawStateTiled(Rect const& src_rect, Rect const& dst_rect, int ox, int oy, DrawState& state) const;
+
 	/**
 	 * Clears all effects data.
 	 */
@@ -318,6 +341,22 @@ private:
 
 	BitmapRef Refresh(Rect& rect, bool& need_scale, int& bush_y);
 
+	/**
+	 * Adds a draw with the current effects to a drawable state.
+	 *
+	 * @param dst_rect covered screen area.
+	 * @param x blit x or tiling ox.
+	 * @param y blit y or tiling oy.
+	 * @param src_rect source rect.
+	 * @param state state of the drawable.
+	 */
+	void AddDrawState(Rect const& dst_rect, int x, int y, Rect const& src_rect, DrawState& state) const;
+
+	/**
+	 * Applies tone, flash and flip effects to the source rect.
+	 */
+	BitmapRef CreateEffects(Rect const& rect) const;
+
 	BitmapRef bitmap_effects;
 	BitmapRef bitmap_scale;
 
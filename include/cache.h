@@ -19,9 +19,15 @@
 #define _CACHE_H_
 
 // Headers
+#include <deque>
+#include <list>
+#include <memory>
 #include <string>
 
 #include "memory_management.h"
+#include "color.h"
+#include "rect.h"
+#include "tone.h"
 
 #include <boost/noncopyable.hpp>
 #include <boost/container/flat_map.hpp>
@@ -30,6 +36,30 @@
  * Cache_
  */
 struct Cache_ : boost::noncopyable {
+	struct Material {
+		enum Type {
+			REND = -1,
+			Backdrop,
+			Battle,
+			Charset,
+			Chipset,
+			Faceset,
+			Gameover,
+			Monster,
+			Panorama,
+			Picture,
+			System,
+			Title,
+			System2,
+			Battle2,
+			Battlecharset,
+			Battleweapon,
+			Frame,
+			END,
+		};
+
+	}; // struct Material
+
 	BitmapRef Backdrop(const std::string& filename);
 	BitmapRef Battle(const std::string& filename);
 	BitmapRef Battle2(const std::string& filename);
@@ -49,6 +79,90 @@ struct Cache_ : boost::noncopyable {
 	BitmapRef Tile(const std::string& filename, int tile_id);
 	void Clear();
 
+	/**
+	 * Bitmap with BitmapScreen effects applied.
+	 * The source is identified by its address and content generation.
+	 */
+	struct EffectKey {
+		Bitmap const* source;
+		uint32_t generation;
+		Rect rect;
+		Tone tone;
+		Color flash;
+		bool flip_x;
+		bool flip_y;
+		double zoom_x;
+		double zoom_y;
+
+		bool operator<(EffectKey const& rhs) const;
+	};
+
+	/**
+	 * Finds an effect bitmap shared between BitmapScreens.
+	 *
+	 * @param key effect key.
+	 * @return cached bitmap, or empty when not cached.
+	 */
+	BitmapRef Effect(EffectKey const& key);
+
+	/**
+	 * Adds an effect bitmap, replacing the ones of the same source and rect
+	 * and evicting the least recently used ones when over the size limit.
+	 *
+	 * @param key effect key.
+	 * @param bmp bitmap with effects applied.
+	 */
+	void AddEffect(EffectKey const& key, BitmapRef const& bmp);
+
+	unsigned GetEffectHits() const;
+	unsigned GetEffectMisses() const;
+
+	struct Job;
+	typedef std::shared_ptr<Job> JobRef;
+
+	/**
+	 * Handle of an image queued by Prefetch.
+	 */
+	struct Prefetched {
+		/**
+		 * Checks whether Get won't wait for the decoder.
+		 *
+		 * @return true if decoded, cached or not decodable.
+		 */
+		bool Ready() const;
+
+		/**
+		 * Gets the bitmap like the material getters do,
+		 * waiting for the decoder if it isn't done yet.
+		 *
+		 * @return bitmap.
+		 */
+		BitmapRef Get() const;
+
+	  private:
+		friend struct Cache_;
+		Prefetched(Cache_& cache, Material::Type type, std::string const& filename);
+
+		Cache_* cache;
+		Material::Type type;
+		std::string filename;
+		JobRef job;
+	};
+
+	/**
+	 * Queues an image for decoding on a worker thread.
+	 * The material getters take the image over when it is requested,
+	 * waiting only if it isn't decoded yet.
+	 *
+	 * @param type material of the image.
+	 * @param filename image name without extension.
+	 * @return handle of the image.
+	 */
+	Prefetched Prefetch(Material::Type type, std::string const& filename);
+
+	Cache_();
+	~Cache_();
+
   private:
 	typedef std::pair<std::string,std::string> string_pair;
 	typedef std::pair<std::string, int> tile_pair;
@@ -59,36 +173,36 @@ struct Cache_ : boost::noncopyable {
 	typedef boost::container::flat_map<tile_pair, std::weak_ptr<Bitmap> > cache_tiles_type;
 	cache_tiles_type cache_tiles;
 
-	struct Material {
-		enum Type {
-			REND = -1,
-			Backdrop,
-			Battle,
-			Charset,
-			Chipset,
-			Faceset,
-			Gameover,
-			Monster,
-			Panorama,
-			Picture,
-			System,
-			Title,
-			System2,
-			Battle2,
-			Battlecharset,
-			Battleweapon,
-			Frame,
-			END,
-		};
-
-	}; // struct Material
+	typedef std::list<std::pair<EffectKey, BitmapRef> > effects_lru_type;
+	typedef boost::container::flat_map<EffectKey, effects_lru_type::iterator> cache_effects_type;
+	effects_lru_type effects_lru;
+	cache_effects_type cache_effects;
+	size_t effects_size;
+	unsigned effect_hits;
+	unsigned effect_misses;
 
 	struct Spec;
 	static Spec const specs_[];
 	BitmapRef LoadBitmap(Spec const& spec, std::string const& filename);
+	BitmapRef LoadBitmap(Material::Type type, std::string const& filename);
 
 	template<Material::Type T>
 	BitmapRef LoadBitmap(std::string const& f);
+
+	struct Decoder;
+	std::unique_ptr<Decoder> decoder;
+
+	/** Prefetched images not taken yet, oldest first in prefetch_order. */
+	typedef boost::container::flat_map<string_pair, JobRef> prefetches_type;
+	prefetches_type prefetches;
+	std::deque<string_pair> prefetch_order;
+
+	/**
+	 * Takes a prefetched image over, waiting for the decoder if needed.
+	 *
+	 * @return bitmap, or empty when not prefetched or not decodable.
+	 */
+	BitmapRef TakePrefetched(string_pair const& key);
 };
 
 #include <mruby.h>
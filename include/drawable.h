@@ -18,6 +18,28 @@
 #ifndef _DRAWABLE_H_
 #define _DRAWABLE_H_
 
+#include <cstddef>
+
+#include "rect.h"
+
+/**
+ * Screen area and state signature of a drawable, used by damage tracking.
+ */
+struct DrawState {
+	DrawState();
+
+	/**
+	 * Adds a draw to the state.
+	 *
+	 * @param rect covered screen area.
+	 * @param signature hash of everything that affects the drawn pixels.
+	 */
+	void Add(Rect const& rect, size_t signature);
+
+	Rect rect;
+	size_t signature;
+};
+
 /**
  * Drawable virtual
  */
@@ -38,6 +60,15 @@ public:
 
 	virtual void Draw(int z_order) = 0;
 
+	/**
+	 * Reports what Draw would draw without drawing.
+	 * Must not change any state, damage tracking calls it every frame.
+	 *
+	 * @param z_order z of the drawn ZObj.
+	 * @param state state to add the draws to.
+	 */
+	virtual void GetDrawState(int z_order, DrawState& state) const = 0;
+
 	Type const type;
 	unsigned const ID;
 	bool visible;
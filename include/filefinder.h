@@ -111,12 +111,13 @@ struct FileFinder_ : boost::noncopyable {
 
 	/**
 	 * Creates stream from UTF-8 file name.
+	 * Doesn't use the search state, so it is safe off the main thread.
 	 *
 	 * @param name UTF-8 string file name.
 	 * @param m stream mode.
 	 * @return NULL if open failed.
 	 */
-	std::unique_ptr<std::fstream> openUTF8(const std::string& name, std::ios::openmode m);
+	static std::unique_ptr<std::fstream> openUTF8(const std::string& name, std::ios::openmode m);
 
 	/*
 	 * { case lowered path, real path }
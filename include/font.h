@@ -19,24 +19,57 @@
 #define _FONT_H_
 
 // Headers
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 #include "memory_management.h"
+#include "rect.h"
 
 #include <mruby.h>
 
 class Color;
-class Rect;
 
 /**
  * Font class.
  */
 class Font {
  public:
-	virtual ~Font() {}
+	virtual ~Font();
+
+	/**
+	 * Normalized glyphs of a string and their positions.
+	 */
+	struct Layout {
+		struct Glyph {
+			/** Code point, or the letter of an ExFont icon. */
+			uint32_t code;
+			bool exfont;
+			/** Offset from the start of the string. */
+			int x;
+		};
+
+		std::vector<Glyph> glyphs;
+		/** Same as GetSize(txt). */
+		Rect size;
+	};
+	typedef std::shared_ptr<Layout const> LayoutRef;
 
 	virtual Rect GetSize(unsigned glyph) const = 0;
 	Rect GetSize(std::string const& txt) const;
 
+	/**
+	 * Gets layout of a string.
+	 * The last LAYOUT_CACHE_SIZE strings are remembered, so redrawn
+	 * strings aren't normalized and measured again.
+	 *
+	 * @param txt UTF-8 string, normalized to NFC unless it is ASCII.
+	 * @return layout of txt.
+	 */
+	LayoutRef GetLayout(std::string const& txt) const;
+
+	enum { LAYOUT_CACHE_SIZE = 256 };
+
 	virtual void Render(Bitmap& bmp, int x, int y, Bitmap const& sys, int color, unsigned glyph) = 0;
 	virtual void Render(Bitmap& bmp, int x, int y, unsigned glyph) = 0;
 
@@ -67,6 +100,10 @@ class Font {
 	size_t pixel_size() const { return size * 96 / 72; }
  protected:
 	Font(const std::string& name, int size, bool bold, bool italic);
+
+ private:
+	struct LayoutCache;
+	mutable std::unique_ptr<LayoutCache> layouts_;
 };
 
 #endif
@@ -0,0 +1,144 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _FRAME_STATS_H_
+#define _FRAME_STATS_H_
+
+// Headers
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+/**
+ * FrameStats class.
+ * Collects per frame timings of the subsystems and keeps
+ * the last frames of each for percentiles.
+ */
+class FrameStats : boost::noncopyable {
+public:
+	/** Timed subsystems. */
+	enum Section {
+		PlayerUpdate,
+		SceneUpdate,
+		/** Whole DrawFrame, including the draw and display sections. */
+		DrawFrame,
+		/** Draws split by Drawable::Type. */
+		DrawWindow,
+		DrawTilemap,
+		DrawSprite,
+		DrawPlane,
+		DrawBackground,
+		DrawDefault,
+		GarbageCollect,
+		UpdateDisplay,
+		AudioUpdate,
+		SECTION_END
+	};
+
+	/** Count of frames kept for the percentiles. */
+	static size_t const HISTORY_SIZE = 256;
+
+	typedef std::chrono::steady_clock clock;
+
+	/**
+	 * Measures a section until destruction.
+	 */
+	class Scope : boost::noncopyable {
+	public:
+		Scope(FrameStats& stats, Section section);
+		~Scope();
+
+	private:
+		FrameStats& stats;
+		Section const section;
+		clock::time_point const start;
+	};
+
+	FrameStats();
+
+	/**
+	 * Adds time to a section of the current frame.
+	 *
+	 * @param section section.
+	 * @param msec time in milliseconds.
+	 */
+	void Add(Section section, double msec);
+
+	/**
+	 * Starts measuring a section until End.
+	 * For callers that can't keep a Scope alive, like Ruby blocks
+	 * that may raise past it.
+	 *
+	 * @param section section.
+	 */
+	void Begin(Section section);
+
+	/**
+	 * Ends the section started last by Begin.
+	 */
+	void End();
+
+	/**
+	 * Moves the current frame to the history.
+	 */
+	void EndFrame();
+
+	/**
+	 * Gets a percentile of a section over the history.
+	 *
+	 * @param section section.
+	 * @param percentile percentile (0 - 100).
+	 * @return time in milliseconds.
+	 */
+	double GetPercentile(Section section, int percentile) const;
+
+	/**
+	 * Gets the count of frames in the history.
+	 *
+	 * @return frame count.
+	 */
+	size_t GetFrameCount() const;
+
+	/**
+	 * Gets the name of a section, as used by Graphics.frame_stats.
+	 *
+	 * @param section section.
+	 * @return name.
+	 */
+	static char const* GetName(Section section);
+
+	/**
+	 * Formats p50/p95/p99 of every section for the overlay.
+	 *
+	 * @return one line per section.
+	 */
+	std::string ToString() const;
+
+private:
+	std::vector<double> current;
+	/** Ring buffer of HISTORY_SIZE frames, SECTION_END values each. */
+	std::vector<double> history;
+	size_t history_pos;
+	size_t history_count;
+	/** Sections started by Begin, innermost last. */
+	std::vector<std::pair<Section, clock::time_point> > open;
+};
+
+#endif
@@ -20,13 +20,15 @@
 
 // Headers
 #include <vector>
-#include <list>
 
 #include "color.h"
+#include "frame_stats.h"
+#include "rect.h"
 #include "zobj.h"
 #include "memory_management.h"
 
 #include <boost/noncopyable.hpp>
+#include <boost/container/flat_map.hpp>
 
 class Drawable;
 
@@ -136,9 +138,11 @@ struct Graphics_ : boost::noncopyable {
 	ZObj* RegisterZObj(int z, Drawable* ID);
 	void RegisterZObj(int z, Drawable* ID, bool multiz);
 	void RemoveZObj(Drawable* ID, bool multiz = false);
+	void RemoveZObj(int z, Drawable* ID);
 	void UpdateZObj(ZObj* zobj, int z);
 
 	bool fps_on_screen;
+	bool stats_on_screen;
 	uint32_t drawable_id;
 
 	void Push();
@@ -170,11 +174,81 @@ struct Graphics_ : boost::noncopyable {
 	int GetFrameRate() const;
 	void SetFrameRate(int v);
 
+	/**
+	 * Gets a pooled solid fill mask.
+	 *
+	 * @param color mask color.
+	 * @return mask, empty when the color needs no mask (opaque black).
+	 */
+	pixman_image_ptr const& GetColorMask(Color const& color);
+
+	/**
+	 * Gets a pooled opacity mask.
+	 *
+	 * @param opacity mask opacity (0 - 255).
+	 * @return mask, empty with full opacity.
+	 */
+	pixman_image_ptr const& GetOpacityMask(int opacity);
+
+	/**
+	 * Gets the count of mask allocations the pool saved in the last frame.
+	 *
+	 * @return saved allocations.
+	 */
+	unsigned GetMaskAllocationsSaved() const;
+
+	/**
+	 * Gets whether damage tracking is enabled.
+	 * Only the screen areas changed since the last frame are redrawn
+	 * and uploaded when enabled.
+	 *
+	 * @return damage tracking state.
+	 */
+	bool GetDamageTracking() const;
+
+	/**
+	 * Enables or disables damage tracking.
+	 *
+	 * @param v whether to enable damage tracking.
+	 */
+	void SetDamageTracking(bool v);
+
+	/**
+	 * Marks a screen area to be redrawn in the next frame.
+	 *
+	 * @param rect screen area.
+	 */
+	void AddDamage(Rect const& rect);
+
+	/**
+	 * Marks the whole screen to be redrawn in the next frame.
+	 */
+	void DamageAll();
+
+	/**
+	 * Gets the subsystem timings of the last frames.
+	 *
+	 * @return frame stats.
+	 */
+	FrameStats const& GetFrameStats() const;
+	FrameStats& GetFrameStats();
+
+	/**
+	 * Requests a full GC at the end of the next frame.
+	 * Done on scene changes and transitions, otherwise the GC only
+	 * runs incremental steps in the time left of each frame.
+	 */
+	void RequestFullGC();
+
   private:
 	void InternUpdate();
 	void UpdateTitle(double fps);
 	void DrawFrame();
 	void DrawOverlay();
+	void UpdateGarbageCollection();
+	void DrawZObj(ZObj const& zobj);
+	Rect GetOverlayRect() const;
+	void CollectDamage();
 
 	bool overlay_visible;
 	double current_fps_;
@@ -198,19 +272,30 @@ struct Graphics_ : boost::noncopyable {
 	uint32_t drawable_creation;
 
 	struct State {
-		State() : zlist_dirty(false) {}
-		std::list<std::unique_ptr<ZObj> > zlist;
-		bool zlist_dirty;
+		ZList zlist;
 	};
 	std::unique_ptr<State> state;
 	std::vector<std::unique_ptr<State> > stack;
 
-	static bool SortZObj(std::unique_ptr<ZObj> const& first, std::unique_ptr<ZObj> const& second);
-
 	BitmapRef const screen_buffer_;
 
 	/** Color for display background. */
 	Color back_color;
+
+	std::vector<pixman_image_ptr> opacity_masks;
+	boost::container::flat_map<uint32_t, pixman_image_ptr> color_masks;
+	unsigned mask_allocations_saved;
+	unsigned last_mask_allocations_saved;
+
+	bool damage_tracking;
+	Rect overlay_rect;
+	std::vector<Rect> damage;
+
+	FrameStats frame_stats;
+
+	bool full_gc_requested;
+	size_t live_after_full_gc;
+	size_t live_after_gc_cycle;
 };
 
 #include <mruby.h>
@@ -3,9 +3,49 @@
 
 #include <iosfwd>
 #include <string>
+#include <boost/container/vector.hpp>
 #include "memory_management.h"
+#include "color.h"
 
 namespace ImageIO {
+/**
+ * Decoded pixels not tied to a Bitmap.
+ * Decoding doesn't touch the VM, so it may run on any thread.
+ */
+struct Image {
+	Image() : width(0), height(0) {}
+
+	/** Decoders write whole rows through this, rows aren't padded. */
+	Color* row(size_t y) { return pixels.data() + width * y; }
+
+	size_t width, height;
+	boost::container::vector<Color> pixels;
+	/** Reason of the failure when decoding failed. */
+	std::string error;
+};
+
+/**
+ * Decodes image from stream.
+ *
+ * @param is source stream
+ * @param transparent whether image is index 0 transparent palette
+ * @param ret decoded image
+ * @return true if success, otherwise false with ret.error set.
+ */
+bool DecodeBMP(std::istream& is, bool transparent, Image& ret);
+bool DecodeXYZ(std::istream& is, bool transparent, Image& ret);
+bool DecodePNG(std::istream& is, bool transparent, Image& ret);
+
+/**
+ * Decodes image file choosing the decoder by extension.
+ *
+ * @param file image path
+ * @param transparent whether image is index 0 transparent palette
+ * @param ret decoded image
+ * @return true if success, otherwise false with ret.error set.
+ */
+bool DecodeImage(std::string const& file, bool transparent, Image& ret);
+
 /**
  * Load image from stream
  *
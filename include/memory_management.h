@@ -26,13 +26,17 @@ typedef uint32_t wchar_t;
 #endif
 
 #include <memory>
+#include <vector>
 
 class Bitmap;
 class BitmapScreen;
 class Font;
+union pixman_image;
 
 typedef std::shared_ptr<Bitmap> BitmapRef;
 typedef std::shared_ptr<BitmapScreen> BitmapScreenRef;
 typedef std::shared_ptr<Font> FontRef;
+typedef std::shared_ptr<pixman_image> pixman_image_ptr;
+typedef std::shared_ptr<std::vector<int16_t> const> MapDataRef;
 
 #endif // _MEMORY_MANAGEMENT_H_
@@ -22,6 +22,7 @@
 #include <string>
 #include <fstream>
 #include <ctime>
+#include <memory>
 
 #include <boost/optional.hpp>
 #include <boost/noncopyable.hpp>
@@ -44,6 +45,7 @@ struct Output_ : boost::noncopyable {
 
 	/**
 	 * Takes screenshot and save it to Main_Data::project_path.
+	 * Only done on request and for errors, not for every message.
 	 *
 	 * @return path of screenshot if success, otherwise none.
 	 */
@@ -91,6 +93,7 @@ struct Output_ : boost::noncopyable {
 
 	/**
 	 * Prints a debug message to the console.
+	 * Messages over DEBUG_LIMIT a second are counted and dropped.
 	 *
 	 * @param fmt formatted debug text to display.
 	 */
@@ -98,6 +101,7 @@ struct Output_ : boost::noncopyable {
 	void Debug(std::string const& fmt);
 
 	Output_();
+	~Output_();
 
 	enum Type { TypeDebug, TypeWarning, TypeError, TYPE_END };
 
@@ -143,6 +147,8 @@ struct Output_ : boost::noncopyable {
 	};
 
 	enum { BUFFER_SIZE = 100, };
+	/** Messages of a type logged per second, errors aren't limited. */
+	enum { DEBUG_LIMIT = 20, WARNING_LIMIT = 10, };
 	typedef boost::circular_buffer<Message> buffer_type;
 
 	/*
@@ -159,16 +165,34 @@ struct Output_ : boost::noncopyable {
 
 	void EnableStdout(bool v);
 
+	/*
+	 * waits until the log thread wrote every message
+	 */
+	void Flush();
+
   private:
 	bool ignore_pause_, enable_stdout_;
-	std::ofstream log_file_;
+
+	/*
+	 * writes the log file and stdout on its own thread,
+	 * messages are passed through a ring buffer without locking.
+	 */
+	struct LogWriter;
+	std::unique_ptr<LogWriter> writer_;
 
 	buffer_type buffer_;
 
 	boost::optional<std::string> frame_screenshot_;
+	// screenshot files below this index exist
+	unsigned screenshot_index_;
+
+	struct RateLimit {
+		std::time_t second;
+		unsigned count, suppressed;
+	} rate_limits_[TYPE_END];
 
   private:
-	std::ostream& output_time(std::time_t t);
+	bool CheckRateLimit(Type t, std::time_t now);
 	template<Type T>
 	void HandleScreenOutput(std::string const& msg, bool exit);
 };
@@ -35,6 +35,7 @@ public:
 	virtual ~Plane();
 
 	void Draw(int z_order);
+	void GetDrawState(int z_order, DrawState& state) const;
 
 	BitmapRef const& GetBitmap() const;
 	void SetBitmap(BitmapRef const& bitmap);
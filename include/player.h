@@ -31,7 +31,9 @@ void run(mrb_state* M = NULL);
 bool is_rpg2k(mrb_state* M = NULL);
 bool is_rpg2k3(mrb_state* M = NULL);
 
-std::string system_graphic(mrb_state* M = NULL);
+// Game_System keeps it up to date through Player.system_graphic=
+std::string const& system_graphic(mrb_state* M = NULL);
+void system_graphic(std::string const& v, mrb_state* M = NULL);
 
 }
 
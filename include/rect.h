@@ -104,7 +104,7 @@ public:
 	 *
 	 * @param rect rect.
 	 */
-	Rect GetSubRect(Rect const& rect);
+	Rect GetSubRect(Rect const& rect) const;
 
 	/** X coordinate. */
 	int x;
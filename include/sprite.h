@@ -36,6 +36,7 @@ public:
 	virtual ~Sprite();
 
 	void Draw(int z_order);
+	void GetDrawState(int z_order, DrawState& state) const;
 
 	void Flash(int duration);
 	void Flash(Color color, int duration);
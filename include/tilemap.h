@@ -36,8 +36,10 @@ public:
 	void SetChipset(BitmapRef const& nchipset);
 	std::vector<int16_t> const& GetMapDataDown() const;
 	void SetMapDataDown(std::vector<int16_t> const& down);
+	void SetMapDataDown(MapDataRef const& down);
 	std::vector<int16_t> const& GetMapDataUp() const;
 	void SetMapDataUp(std::vector<int16_t> const& up);
+	void SetMapDataUp(MapDataRef const& up);
 	std::vector<uint8_t> const& GetPassableUp() const;
 	void SetPassableUp(std::vector<uint8_t> const& up);
 	std::vector<uint8_t> const& GetPassableDown() const;
@@ -58,6 +60,8 @@ public:
 	void SetAnimationSpeed(int speed);
 	int GetAnimationType() const;
 	void SetAnimationType(int type);
+	bool GetChunked() const;
+	void SetChunked(bool nchunked);
 	void SubstituteDown(int old_id, int new_id);
 	void SubstituteUp(int old_id, int new_id);
 
@@ -34,6 +34,7 @@ public:
 
 	void DrawTile(BitmapScreen& screen, int x, int y, int row, int col, bool autotile);
 	void Draw(int z_order);
+	void GetDrawState(int z_order, DrawState& state) const;
 
 	void Update();
 
@@ -41,6 +42,13 @@ public:
 	void SetChipset(BitmapRef const& nchipset);
 	std::vector<int16_t> const& GetMapData() const;
 	void SetMapData(std::vector<int16_t> const& nmap_data);
+	/**
+	 * Sets the map data without copying it.
+	 * The data is shared and must not be modified afterwards.
+	 *
+	 * @param nmap_data shared map data.
+	 */
+	void SetMapData(MapDataRef const& nmap_data);
 	std::vector<uint8_t> const& GetPassable() const;
 	void SetPassable(std::vector<uint8_t> const& npassable);
 	int GetOx() const;
@@ -56,13 +64,16 @@ public:
 	int GetAnimationType() const;
 	void SetAnimationType(int type);
 
+	bool GetChunked() const;
+	void SetChunked(bool nchunked);
+
 	int GetZ() const;
 	void Substitute(int old_id, int new_id);
 
 private:
 	BitmapRef chipset;
 	BitmapScreenRef chipset_screen;
-	std::vector<int16_t> map_data;
+	MapDataRef map_data;
 	std::vector<uint8_t> passable;
 	std::vector<uint8_t> substitutions;
 	int ox;
@@ -77,6 +88,9 @@ private:
 
 	int layer;
 
+	/** Bumped when the map, chipset or tile mapping changes, for damage tracking. */
+	uint32_t revision;
+
 	void GenerateAutotileAB(short ID, short animID);
 	void GenerateAutotileD(short ID);
 
@@ -114,6 +128,60 @@ private:
 		int z;
 	};
 	std::vector<std::vector<TileData> > data_cache;
+
+	void DrawTileData(short ID, int x, int y);
+
+	/**
+	 * Gets the atlas and the tile coordinates a tile ID is drawn from.
+	 *
+	 * @return atlas screen, or NULL if the tile isn't drawn in this layer.
+	 */
+	BitmapScreen* GetTileSource(short ID, int& row, int& col);
+
+	bool IsAnimated(short ID) const;
+
+	/**
+	 * Visible tile with its screen position, binned by drawing z.
+	 */
+	struct TileDraw {
+		int x;
+		int y;
+		short ID;
+	};
+	typedef boost::container::flat_map<int, std::vector<TileDraw> > z_buckets_type;
+
+	/**
+	 * Bins the visible tiles by z so each Draw(z) only walks its own bucket.
+	 * Rebuilt lazily after ox, oy, size or map data changes.
+	 */
+	void UpdateZBuckets();
+
+	z_buckets_type z_buckets;
+	bool z_buckets_dirty;
+
+	/** Chunk size in tiles (256x256 pixels). */
+	static const int CHUNK_TILES = 16;
+
+	/**
+	 * Pre-rendered block of z 0 tiles.
+	 * Animated tiles are kept in a list to be redrawn on animation steps.
+	 */
+	struct Chunk {
+		BitmapScreenRef screen;
+		std::vector<TileDraw> animated;
+	};
+	typedef boost::container::flat_map<uint32_t, Chunk> chunks_type;
+
+	/**
+	 * Bakes the chunks getting visible and drops the ones scrolled out.
+	 */
+	void UpdateChunks();
+	void BakeChunk(int cx, int cy, Chunk& chunk);
+	void RefreshAnimatedChunks();
+	void InvalidateChunks();
+
+	bool chunked;
+	chunks_type chunks;
 };
 
 #endif
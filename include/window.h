@@ -34,6 +34,7 @@ public:
 	virtual ~Window();
 
 	void Draw(int z_order);
+	void GetDrawState(int z_order, DrawState& state) const;
 
 	void Update();
 	BitmapRef const& GetWindowskin() const;
@@ -19,7 +19,14 @@
 #define _ZOBJ_H_
 
 // Headers
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "rect.h"
+
+#include <boost/noncopyable.hpp>
 
 class Drawable;
 
@@ -35,10 +42,93 @@ public:
 	uint32_t GetCreation() const;
 	Drawable* GetId() const;
 
+	/**
+	 * Screen area covered in the last drawn frame.
+	 * Used by damage tracking.
+	 */
+	Rect const& GetScreenRect() const;
+	void SetScreenRect(Rect const& rect);
+
+	/**
+	 * Signature of what was drawn in the last frame.
+	 * 0 forces a redraw.
+	 */
+	size_t GetSignature() const;
+	void SetSignature(size_t signature);
+
 private:
 	int z;
 	uint32_t creation;
 	Drawable* ID;
+
+	Rect screen_rect;
+	size_t signature;
+};
+
+/**
+ * ZList class.
+ * ZObjs kept sorted by z and creation in a contiguous array.
+ * Changes move single entries so no full sort is ever needed.
+ */
+class ZList : boost::noncopyable {
+public:
+	/** Sort key copied out of the owned ZObj to keep the search cache friendly. */
+	struct Entry {
+		int z;
+		uint32_t creation;
+		ZObj* zobj;
+	};
+
+	typedef std::vector<Entry> container_type;
+	typedef container_type::const_iterator const_iterator;
+
+	ZList();
+	~ZList();
+
+	/**
+	 * Inserts a ZObj after the ones with the same z and creation.
+	 *
+	 * @param z z order.
+	 * @param creation creation order.
+	 * @param id drawable.
+	 * @return inserted ZObj.
+	 */
+	ZObj* Insert(int z, uint32_t creation, Drawable* id);
+
+	/**
+	 * Removes the ZObj of a drawable with binary search.
+	 * Falls back to a linear search when z doesn't match the stored one.
+	 *
+	 * @param z current z of the ZObj.
+	 * @param id drawable.
+	 * @return removed ZObj, empty if not found.
+	 */
+	std::unique_ptr<ZObj> Remove(int z, Drawable* id);
+
+	/**
+	 * Removes every ZObj of a drawable.
+	 *
+	 * @param id drawable.
+	 */
+	void Remove(Drawable* id);
+
+	/**
+	 * Changes z of a ZObj and moves it to its new place.
+	 *
+	 * @param zobj ZObj to update.
+	 * @param z new z.
+	 * @return whether zobj is in this list.
+	 */
+	bool Update(ZObj* zobj, int z);
+
+	const_iterator begin() const;
+	const_iterator end() const;
+	size_t size() const;
+
+private:
+	container_type::iterator Find(ZObj const* zobj);
+
+	container_type data;
 };
 
 #endif
@@ -10,9 +10,15 @@
 
 #include <boost/mpl/or.hpp>
 #include <boost/optional.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <type_traits>
 
 class Bitmap;
@@ -50,21 +56,95 @@ struct is_disposable : public boost::mpl::or_<
 	std::is_same<T, Bitmap>,
 	user_defined_disposable<T> > {};
 
+template<class T, class Enable = void> struct disposer_newer;
+
 template<class T> struct mruby_data_type {
 	static mrb_data_type data;
 	static std::string outer;
 
 	static RClass* get_class(mrb_state* M) {
 		assert(data.struct_name);
-		return outer.empty()
+		if(M == class_vm) { return cls; }
+
+		RClass* const ret = outer.empty()
 				? mrb_class_get(M, data.struct_name)
 				: mrb_class_get_under(M, mrb_class_get(M, outer.c_str()), data.struct_name);
+		set_class(M, ret);
+		return ret;
+	}
+
+	// define_class sets it again for each new VM, so a VM reusing an address is safe
+	static void set_class(mrb_state* M, RClass* c) {
+		class_vm = M;
+		cls = c;
 	}
+
+  private:
+	// class in the last VM asking for it
+	static mrb_state* class_vm;
+	static RClass* cls;
 };
 template<class T> mrb_data_type mruby_data_type<T>::data = { NULL, NULL };
 template<class T> std::string mruby_data_type<T>::outer;
+template<class T> mrb_state* mruby_data_type<T>::class_vm = NULL;
+template<class T> RClass* mruby_data_type<T>::cls = NULL;
 
-template<class T, class Enable = void> struct disposer_newer;
+template<class T>
+struct is_small_value : std::integral_constant<bool,
+	not is_disposable<T>::value and
+	boost::has_trivial_copy<T>::value and boost::has_trivial_destructor<T>::value and
+	sizeof(T) <= 4 * sizeof(void*)> {};
+
+// values fitting the data pointer of RData are stored in it, without an allocation
+template<class T>
+struct is_inline_value : std::integral_constant<bool,
+	is_small_value<T>::value and sizeof(T) <= sizeof(void*) and
+	boost::alignment_of<T>::value <= boost::alignment_of<void*>::value> {};
+
+// other small values like Rect come from a free list instead of mrb_malloc
+template<class T>
+struct is_pooled_value : std::integral_constant<bool,
+	is_small_value<T>::value and not is_inline_value<T>::value> {};
+
+/*
+ * free list of fixed size blocks, never returned to the system.
+ * only used from the thread running the VMs like the rest of the binder.
+ */
+template<size_t Size>
+struct block_pool {
+	enum { CHUNK = 64 };
+
+	static void* allocate() {
+		if(not free_) {
+			char* const chunk = static_cast<char*>(::operator new(block_size() * CHUNK));
+			for(size_t i = 0; i < CHUNK; ++i) { deallocate(chunk + block_size() * i); }
+		}
+		void* const ret = free_;
+		free_ = *static_cast<void**>(ret);
+		return ret;
+	}
+
+	static void deallocate(void* const ptr) {
+		*static_cast<void**>(ptr) = free_;
+		free_ = ptr;
+	}
+
+  private:
+	static size_t block_size() {
+		size_t const align = boost::alignment_of<std::max_align_t>::value;
+		return (std::max(Size, sizeof(void*)) + align - 1) / align * align;
+	}
+
+	static void* free_;
+};
+template<size_t Size> void* block_pool<Size>::free_ = NULL;
+
+template<class T>
+void* allocate_data(mrb_state* M) {
+	return is_pooled_value<T>::value
+			? block_pool<sizeof(T)>::allocate()
+			: mrb_malloc(M, sizeof(typename disposer_newer<T>::cxx_type));
+}
 
 template<class T>
 std::shared_ptr<T>& get_ptr(mrb_state* M, mrb_value const& v,
@@ -119,9 +199,16 @@ struct disposer_newer<T, typename std::enable_if<not is_disposable<T>::value>::t
 	typedef T cxx_type;
 
 	static void deleter(mrb_state* M, void* ptr) {
+		// inline values are trivially destructible and own no memory
+		if(is_inline_value<T>::value) { return; }
+
 		cxx_type* const ref = reinterpret_cast<cxx_type*>(ptr);
 		ref->~cxx_type();
-		mrb_free(M, ptr);
+		if(is_pooled_value<T>::value) {
+			block_pool<sizeof(T)>::deallocate(ptr);
+		} else {
+			mrb_free(M, ptr);
+		}
 	}
 
 	static void register_(mrb_state*, RClass* cls) {
@@ -148,15 +235,25 @@ T& get(mrb_state* M, mrb_value const& v, typename std::enable_if<is_disposable<T
 }
 
 template<class T>
-T& get(mrb_state* M, mrb_value const& v, typename std::enable_if<not is_disposable<T>::value>::type* = 0) {
+T& get(mrb_state* M, mrb_value const& v, typename std::enable_if<
+		   not is_disposable<T>::value and not is_inline_value<T>::value>::type* = 0) {
 	void* const ptr = mrb_data_get_ptr(M, v, &mruby_data_type<T>::data);
 	assert(ptr);
 	return *reinterpret_cast<T*>(ptr);
 }
 
+template<class T>
+T& get(mrb_state* M, mrb_value const& v, typename std::enable_if<is_inline_value<T>::value>::type* = 0) {
+	// the pointer is the value, it may be all zero
+	mrb_data_check_type(M, v, &mruby_data_type<T>::data);
+	return *reinterpret_cast<T*>(&DATA_PTR(v));
+}
+
 template<class T>
 bool is(mrb_state* M, mrb_value const& v) {
-	return mrb_data_check_get_ptr(M, v, &mruby_data_type<T>::data);
+	return is_inline_value<T>::value
+			? mrb_type(v) == MRB_TT_DATA and DATA_TYPE(v) == &mruby_data_type<T>::data
+			: mrb_data_check_get_ptr(M, v, &mruby_data_type<T>::data) != NULL;
 }
 
 inline mrb_value to_mrb(mrb_state* M, std::string const& str) {
@@ -191,6 +288,7 @@ RClass* define_class(mrb_state* M, char const* name, RClass* outer = NULL, RClas
 
 	RClass* const ret = mrb_define_class_under(M, outer, name, base);
 	disposer_newer<T>::register_(M, ret);
+	mruby_data_type<T>::set_class(M, ret);
 
 	return ret;
 }
@@ -234,7 +332,12 @@ inline void wrong_argument(mrb_state* M) {
 
 template<class T>
 void* data_make_struct(mrb_state* M, RClass* cls, RData*& data) {
-	void* const ret = mrb_malloc(M, sizeof(typename disposer_newer<T>::cxx_type));
+	if(is_inline_value<T>::value) {
+		data = mrb_data_object_alloc(M, cls, NULL, &mruby_data_type<T>::data);
+		return &data->data;
+	}
+
+	void* const ret = allocate_data<T>(M);
 	data = mrb_data_object_alloc(M, cls, ret, &mruby_data_type<T>::data);
 	return ret;
 }
@@ -242,10 +345,11 @@ void* data_make_struct(mrb_state* M, RClass* cls, RData*& data) {
 template<class T>
 void* data_make_struct(mrb_state* M, mrb_value const& v) {
 	assert(mrb_type(v) == MRB_TT_DATA);
-	assert(not DATA_PTR(v));
-	void* const ret = mrb_malloc(M, sizeof(typename disposer_newer<T>::cxx_type));
+	assert(not DATA_PTR(v) and not DATA_TYPE(v));
 	DATA_TYPE(v) = &mruby_data_type<T>::data;
-	return DATA_PTR(v) = ret;
+	if(is_inline_value<T>::value) { return &DATA_PTR(v); }
+
+	return DATA_PTR(v) = allocate_data<T>(M);
 }
 
 template<class T>
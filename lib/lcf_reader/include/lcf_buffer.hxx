@@ -0,0 +1,147 @@
+#ifndef LCF_BUFFER_HXX
+#define LCF_BUFFER_HXX
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container/flat_map.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include "lcf_reader_fwd.hxx"
+
+namespace LCF {
+	namespace detail {
+		struct string_ref_hash {
+			size_t operator()(boost::string_ref const& s) const {
+				return boost::hash_range(s.begin(), s.end());
+			}
+		};
+	} // namespace detail
+
+	/*
+	 * contiguous read only image of a whole LCF file.
+	 * either a memory mapping of the file or an owned copy of the bytes.
+	 */
+	struct buffer : boost::noncopyable {
+		static buffer_ref map(std::string const& file);
+		static buffer_ref read(std::istream& is);
+		// takes the contents of data, leaving it empty
+		static buffer_ref own(vector<char>& data);
+
+		~buffer();
+
+		uint8_t const* data() const { return data_; }
+		size_t size() const { return size_; }
+
+		/*
+		 * decodes the little endian array at [base, base + s) once.
+		 * later calls with the same base and T share the decoded values.
+		 */
+		template<class T>
+		std::shared_ptr<std::vector<T> const> decode_array(size_t const base, size_t const s) const {
+			assert((s % sizeof(T)) == 0);
+			// corrupted files may point past the end
+			if(base > size_ or s > size_ - base) {
+				return std::make_shared<std::vector<T> const>();
+			}
+
+			// keyed by type too, a hit is cast back to it
+			std::shared_ptr<void const>& cached = arrays_[array_key(base, typeid(T))];
+			if(cached) { return std::static_pointer_cast<std::vector<T> const>(cached); }
+
+			std::shared_ptr<std::vector<T> > const ret =
+					std::make_shared<std::vector<T> >(s / sizeof(T));
+			uint8_t const* p = data_ + base;
+			for(size_t i = 0; i < ret->size(); ++i, p += sizeof(T)) {
+				uint32_t v = 0;
+				for(size_t j = 0; j < sizeof(T); ++j) {
+					v |= uint32_t(p[j]) << (8*j);
+				}
+				(*ret)[i] = T(v);
+			}
+			cached = ret;
+			return ret;
+		}
+
+		// slot of the chunk index of the array at base, see array1d and array2d
+		detail::chunk_index_ref& chunk_index(size_t const base) const {
+			return indices_[base];
+		}
+
+		// slot of the decoded commands of the event at base, see event
+		detail::event_data_ref& event_data(size_t const base) const {
+			return events_[base];
+		}
+
+		/*
+		 * decodes the string at [base, base + s).
+		 * equal strings in the file are decoded once with the codepage at that time.
+		 * returns an empty string when the range runs past the end.
+		 */
+		std::string const& string(size_t base, size_t s) const;
+
+	  private:
+		buffer();
+
+		uint8_t const* data_;
+		size_t size_;
+		vector<char> owned_;
+		void* mapped_;
+		typedef std::pair<size_t, std::type_index> array_key;
+		mutable boost::container::flat_map<array_key, std::shared_ptr<void const> > arrays_;
+		mutable std::unordered_map<size_t, detail::chunk_index_ref> indices_;
+		mutable std::unordered_map<size_t, detail::event_data_ref> events_;
+		mutable std::unordered_map<boost::string_ref, std::string, detail::string_ref_hash> strings_;
+	}; // struct buffer
+
+	/*
+	 * decodes values straight from a buffer.
+	 * reading past the end stops at the end and makes the cursor bad.
+	 */
+	struct cursor {
+		cursor() : buffer_(NULL), begin_(NULL), cur_(NULL), end_(NULL), good_(true) {}
+		cursor(buffer const& buf, size_t const pos)
+				: buffer_(&buf), begin_(buf.data()), cur_(buf.data() + std::min(pos, buf.size()))
+				, end_(buf.data() + buf.size()), good_(pos <= buf.size()) {}
+
+		size_t tell() const { return cur_ - begin_; }
+		bool eof() const { return cur_ >= end_; }
+		bool good() const { return good_; }
+		size_t remaining() const { return end_ - cur_; }
+		uint8_t const* ptr() const { return cur_; }
+
+		void seek(size_t const pos) {
+			if(pos > size_t(end_ - begin_)) { cur_ = end_; good_ = false; }
+			else { cur_ = begin_ + pos; }
+		}
+		void skip(size_t const s) {
+			if(s > remaining()) { cur_ = end_; good_ = false; }
+			else { cur_ += s; }
+		}
+
+		uint32_t ber();
+		std::string string(size_t const s);
+		std::string string();
+
+	  private:
+		buffer const* buffer_;
+		uint8_t const* begin_;
+		uint8_t const* cur_;
+		uint8_t const* end_;
+		bool good_;
+	}; // struct cursor
+} // namespace LCF
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef LCF_PRELOADER_HXX
+#define LCF_PRELOADER_HXX
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <boost/noncopyable.hpp>
+
+#include "lcf_reader.hxx"
+
+namespace LCF {
+	/*
+	 * opens LCF files on worker threads before they are needed.
+	 * a worker builds every chunk index, decodes the int arrays and
+	 * collects the linked ids of event commands, e.g. teleport targets.
+	 * a file is only touched by its worker until take() hands it over,
+	 * so the caches of its buffer need no locking.
+	 */
+	struct preloader : boost::noncopyable {
+		// event commands with link_code name another file in argument link_arg
+		preloader(uint32_t link_code, size_t link_arg, size_t threads = 0);
+		~preloader();
+
+		/*
+		 * replaces the queue with files, in priority order.
+		 * loaded or queued files missing in files are dropped.
+		 */
+		void preload(vector<std::string> const& files);
+
+		/*
+		 * hands file over to the caller.
+		 * waits when a worker is loading it and loads it here when it wasn't requested.
+		 * links gets the sorted and unique linked ids in the file.
+		 */
+		void take(std::string const& file, lcf_file& ret, vector<int32_t>& links);
+
+		bool loaded(std::string const& file) const;
+
+	  private:
+		struct entry {
+			enum state_t { queued, loading, done, failed };
+
+			entry() : state(queued) {}
+
+			state_t state;
+			lcf_file file;
+			vector<int32_t> links;
+		};
+		typedef std::shared_ptr<entry> entry_ref;
+
+		void work();
+		void load(std::string const& file, entry& e) const;
+
+		uint32_t const link_code_;
+		size_t const link_arg_;
+
+		mutable std::mutex mutex_;
+		std::condition_variable queued_, done_;
+		std::deque<std::string> queue_;
+		std::map<std::string, entry_ref> entries_;
+		bool quit_;
+		vector<std::thread> workers_;
+	}; // struct preloader
+} // namespace LCF
+
+#endif
@@ -9,38 +9,30 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/optional.hpp>
 
+#include "lcf_buffer.hxx"
 #include "lcf_reader_fwd.hxx"
+#include "lcf_schema.hxx"
 #include "picojson.hxx"
 
 namespace LCF {
-	picojson const& get_schema(picojson_string const& name);
-	bool has_default(picojson const& sch);
-
 	namespace detail {
 		template<class T>
 		struct array {
 			typedef T value_type;
+			typedef std::shared_ptr<std::vector<value_type> const> values_ref;
 
-			array() : base_(0), size_(0) {}
-			array(istream_ref const& is, size_t const s)
-				: stream_(is), base_(is->tellg()), size_(s)
-			{
-				assert((s % sizeof(value_type)) == 0);
-				stream_->seekg(s, std::istream::cur);
-			}
+			array() {}
+			array(buffer_ref const& buf, size_t const base, size_t const s)
+				: values_(buf->decode_array<value_type>(base, s)) {}
+
+			size_t size() const { return values_? values_->size() : 0; }
+			value_type const* data() const { return values_? values_->data() : NULL; }
 
-			size_t size() const { return (size_ == 0)? 0 : size_ / sizeof(value_type); }
+			// decoded values shared with the buffer cache and other copies
+			values_ref const& values() const { return values_; }
 
 			void to_vector(vector<value_type>& ret) const {
-				stream_->seekg(base_);
-				ret.resize(size());
-				for(size_t i = 0; i < size(); ++i) {
-					value_type v = 0;
-					for(size_t j = 0; j < sizeof(T); ++j) {
-						v |= (stream_->get() & 0xffU) << (8*j);
-					}
-					ret[i] = v;
-				}
+				ret.assign(data(), data() + size());
 			}
 
 			operator vector<value_type>() const {
@@ -51,42 +43,93 @@ namespace LCF {
 
 			value_type operator[](size_t const idx) const {
 				assert(idx < size());
-				value_type ret = 0;
-				stream_->seekg(base_ + sizeof(T) * idx);
-				for(size_t i = 0; i < sizeof(T); ++i) {
-					ret |= (stream_->get() & 0xff) << (8*i);
-				}
-				return ret;
+				return (*values_)[idx];
 			}
 		private:
-			istream_ref stream_;
-			size_t base_, size_;
+			values_ref values_;
 		}; //struct array
+
+		// key and position of an array1d element or an array2d row
+		struct chunk {
+			uint32_t key;
+			size_t base, size;
+			// field of array1d chunks, unknown_field if missing in the schema
+			schema::field const* field;
+		};
+
+		// chunks of an array1d or array2d sorted by key
+		struct chunk_index {
+			vector<chunk> chunks;
+			// byte position and size of the whole array
+			size_t base, size;
+		};
 	} // namespace detail
 
+	/*
+	 * event commands of a page decoded into one arena.
+	 * strings stay in the buffer and are decoded on access,
+	 * copies and commands share the arena.
+	 * the arena is kept by the buffer, a page is decoded once.
+	 */
+	struct event {
+		typedef detail::event_data data;
+		typedef detail::event_data_ref data_ref;
+
+		event() {}
+		event(buffer_ref const& buf, cursor& c, size_t end);
+
+		size_t size() const;
+		bool empty() const { return size() == 0; }
+		event_command operator[](size_t idx) const;
+
+		// strings of the commands with code, collected once per page
+		vector<std::string> const& strings(uint32_t code) const;
+
+		// copies the commands as is
+		void write(writer& w) const;
+
+	  private:
+		// the arena doesn't own the buffer keeping it
+		buffer_ref buffer_;
+		data_ref data_;
+	}; // struct event
+
+	// view of a command in an event
 	struct event_command {
-		uint32_t code;
-		size_t nest;
-		std::string str;
-		vector<int32_t> args;
+		event_command() : index_(0) {}
+		event_command(buffer_ref const& buf, event::data_ref const& d, size_t idx)
+				: buffer_(buf), data_(d), index_(idx) {}
 
-		void swap(event_command& rhs);
+		uint32_t code() const;
+		uint32_t nest() const;
+		std::string str() const;
+
+		size_t args_size() const;
+		int32_t const* args() const;
+		int32_t arg(size_t idx) const;
+
+		void write(writer& w) const;
+
+	  private:
+		buffer_ref buffer_;
+		event::data_ref data_;
+		size_t index_;
 	}; // struct event_command
 
 	struct map_tree : public vector<int32_t> {
-		map_tree(std::istream& is);
+		map_tree(cursor& c);
 
 		int active_node;
 	};
 
 	struct ber_array : public vector<int32_t> {
-		ber_array(std::istream& is, size_t len);
+		ber_array(cursor& c, size_t len);
 	};
 
 	struct element {
-		element(picojson const& sch, istream_ref const& is, size_t const s);
+		element(schema::field const& f, buffer_ref const& buf, size_t const base, size_t const s);
 
-		bool exists() const { return bool(stream_); }
+		bool exists() const { return bool(buffer_); }
 
 		template<class T> T get() const { return to<T>(); }
 
@@ -112,30 +155,36 @@ namespace LCF {
 		element operator[](picojson_string const& k) const;
 		element operator[](char const* k) const;
 
-		boost::optional<array1d const&> get(uint32_t const k) const;
+		boost::optional<array1d> get(uint32_t const k) const;
 		boost::optional<element> get(picojson_string const& k) const;
 		boost::optional<element> get(char const* k) const;
 
 		void to_json(picojson& ret) const;
 		void write(std::ostream& os) const;
 
-		picojson_string const& type() const;
-		picojson const& schema() const;
+		schema::type_t type() const;
+		schema::field const& field() const;
 
 	  private:
 		template<class T> T to() const;
-		template<class T> T to_impl() const;
-		void check_type(picojson_string const& name) const;
+		template<class T> T to_impl(cursor& c) const;
+		void check_type(schema::type_t t) const;
 
-		picojson const* schema_;
-		istream_ref stream_;
+		schema::field const* field_;
+		buffer_ref buffer_;
 		size_t base_, size_;
 	}; // struct element
 
-	struct array1d : public detail::array1d_base {
+	/*
+	 * views of an array in the buffer.
+	 * the chunk index of each array is built on first touch and
+	 * cached in the buffer, so copies and later views share it.
+	 */
+	struct array1d {
+		typedef vector<detail::chunk>::const_iterator const_iterator;
+
 		array1d();
-		array1d(picojson const& sch, istream_ref const& is);
-		array1d(picojson const& sch, istream_ref const& is, int index);
+		array1d(schema::table const& t, buffer_ref const& buf, cursor& c, int index = 0);
 		array1d(array1d const& rhs);
 
 		array1d& operator =(array1d const&);
@@ -146,42 +195,59 @@ namespace LCF {
 
 		boost::optional<element> get(picojson_string const& k) const;
 		boost::optional<element> get(char const* k) const;
+		boost::optional<element> get(char const* k, size_t len) const;
 		boost::optional<element> get(uint32_t const k) const;
 
+		const_iterator begin() const;
+		const_iterator end() const;
+		size_t size() const;
+		element at(const_iterator i) const;
+
 		int index() const;
 		bool is_a2d() const;
 		bool is_valid() const;
 
 		void to_json(picojson& ret) const;
+		// copies the array as is
+		void write(writer& w) const;
 
 	private:
-		istream_ref stream_;
-		size_t base_, size_;
-		picojson const* schema_;
+		buffer_ref buffer_;
+		detail::chunk_index_ref chunks_;
+		schema::table const* table_;
 		int index_;
 	}; // class array1d
 
-	struct array2d : public detail::array2d_base {
+	struct array2d {
+		typedef vector<detail::chunk>::const_iterator const_iterator;
+
 		array2d();
-		array2d(picojson const& sch, istream_ref const& is);
+		array2d(schema::table const& t, buffer_ref const& buf, cursor& c);
 		array2d(array2d const& rhs);
 
-		array1d const& operator[](uint32_t const k) const;
-		boost::optional<array1d const&> get(uint32_t const k) const;
+		array1d operator[](uint32_t const k) const;
+		boost::optional<array1d> get(uint32_t const k) const;
+
+		const_iterator begin() const;
+		const_iterator end() const;
+		size_t size() const;
+		array1d at(const_iterator i) const;
 
 		array2d& operator =(array2d const&);
 
 		void to_json(picojson& ret) const;
+		void write(writer& w) const;
 
 	private:
-		istream_ref stream_;
-		size_t base_, size_;
-		picojson const* schema_;
+		buffer_ref buffer_;
+		detail::chunk_index_ref chunks_;
+		schema::table const* table_;
 	}; // class array2d
 
 	struct lcf_file {
 		lcf_file();
 		lcf_file(istream_ref const& is);
+		lcf_file(buffer_ref const& buf);
 		lcf_file(std::string const& file);
 		lcf_file(BOOST_RV_REF(lcf_file) rhs);
 		~lcf_file();
@@ -192,9 +258,10 @@ namespace LCF {
 
 		boost::optional<element> get(picojson_string const& n) const;
 		boost::optional<element> get(char const* n) const;
-		boost::optional<array1d const&> get(uint32_t const idx) const;
+		boost::optional<array1d> get(uint32_t const idx) const;
 
 		element const& root(size_t index) const;
+		size_t root_count() const { return elem_.size(); }
 
 		void to_json(picojson& ret) const;
 
@@ -206,23 +273,20 @@ namespace LCF {
 	private:
 		void init();
 
-		picojson const* schema_;
-		istream_ref stream_;
-		picojson_string signature_;
+		schema::file const* schema_;
+		buffer_ref buffer_;
+		// not a flyweight, its factory isn't locked and preloader threads open files
+		std::string signature_;
 
 		std::string error_;
 
 		vector<element> elem_;
 	}; // struct lcf_file
 
-	size_t calculate_size(picojson const& data, picojson const& schema);
 	bool save_lcf(picojson const& data, std::ostream& os);
-	void save_element(picojson const& data, picojson const& schema, std::ostream& os);
-	void save_array1d(picojson const& data, picojson const& schema, std::ostream& os);
-	void save_array2d(picojson const& data, picojson const& schema, std::ostream& os);
-	picojson const& actual_schema(picojson const& sch, picojson_string const& type);
-	picojson const& find_schema(picojson const& sch, uint32_t k);
-	picojson const& find_schema(picojson const& sch, picojson_string const& k);
+	void save_element(writer& w, picojson const& data, schema::field const& f);
+	void save_array1d(writer& w, picojson const& data, schema::table const& t);
+	void save_array2d(writer& w, picojson const& data, schema::table const& t);
 
 	bool operator==(array1d const& lhs, array1d const& rhs);
 	bool operator==(array2d const& lhs, array2d const& rhs);
@@ -13,10 +13,13 @@
 namespace LCF {
 
 	typedef std::shared_ptr<std::istream> istream_ref;
+	struct buffer;
+	typedef std::shared_ptr<buffer const> buffer_ref;
+	struct writer;
 	using boost::container::vector;
 
 	struct event_command;
-	typedef vector<event_command> event;
+	struct event;
 	struct element;
 	struct array1d;
 	struct array2d;
@@ -26,8 +29,11 @@ namespace LCF {
 	namespace detail {
 		template<class T> struct array;
 
-		typedef boost::container::flat_map<uint32_t, element> array1d_base;
-		typedef boost::container::flat_multimap<uint32_t, array1d> array2d_base;
+		struct chunk;
+		struct chunk_index;
+		typedef std::shared_ptr<chunk_index const> chunk_index_ref;
+		struct event_data;
+		typedef std::shared_ptr<event_data const> event_data_ref;
 	} // namespace detail
 
 	typedef detail::array<uint8_t> int8_array;
@@ -0,0 +1,90 @@
+#ifndef LCF_SCHEMA_HXX
+#define LCF_SCHEMA_HXX
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * schema tables generated from the json files in schema/ by to_cxx.rb.
+ * both the reader and the writer look fields up through these.
+ */
+namespace LCF {
+namespace schema {
+	enum type_t {
+		unknown, // chunk missing in the schema, read as raw bytes
+		integer, bool_, float_, string, event, map_tree,
+		int8array, int16array, int32array, ber_array,
+		array1d, array2d,
+	};
+
+	struct table;
+
+	struct field {
+		uint32_t index;
+		char const* name;
+		// named types are resolved to array1d or array2d
+		type_t type;
+		// fields of array1d or rows of array2d
+		table const* value;
+
+		bool has_default;
+		int32_t int_value; // integer and bool
+		double float_value;
+		char const* string_value;
+	};
+
+	struct table {
+		char const* name;
+		// in index order
+		field const* fields;
+		uint32_t field_count;
+
+		// index -> field, NULL for missing indices
+		field const* const* by_index;
+		uint32_t max_index;
+
+		/*
+		 * perfect hash of names: the seed of slot is
+		 * name_seeds[hash(name, 0) & name_seed_mask],
+		 * name_slots[hash(name, seed) & name_mask] is the position in fields or -1
+		 */
+		int16_t const* name_slots;
+		uint32_t name_mask;
+		uint32_t const* name_seeds;
+		uint32_t name_seed_mask;
+	};
+
+	struct file {
+		char const* signature;
+		field const* root;
+		uint32_t root_count;
+	};
+
+	extern file const files[];
+	extern size_t const file_count;
+	extern field const unknown_field;
+
+	// FNV-1a with a final mix, to_cxx.rb computes the same
+	inline uint32_t hash(char const* str, size_t const len, uint32_t const seed) {
+		uint32_t h = 2166136261U ^ seed;
+		for(size_t i = 0; i < len; ++i) {
+			h ^= uint8_t(str[i]);
+			h *= 16777619U;
+		}
+		// mix high bits into the masked low bits
+		h ^= h >> 16;
+		h *= 0x85ebca6bU;
+		return h ^ (h >> 13);
+	}
+
+	inline field const* find(table const& t, uint32_t const index) {
+		return (index <= t.max_index)? t.by_index[index] : NULL;
+	}
+	field const* find(table const& t, char const* name, size_t len);
+	file const* find_file(char const* signature, size_t len);
+
+	char const* type_name(type_t t);
+} // namespace schema
+} // namespace LCF
+
+#endif
@@ -12,14 +12,16 @@ namespace LCF {
 
 	size_t ber_size(uint32_t const v);
 	uint32_t ber(std::istream& is);
+	uint32_t ber(uint8_t const*& p, uint8_t const* end);
 	std::ostream& ber(std::ostream& os, uint32_t const v);
 
 	std::string read_string(std::istream& is, size_t const s);
 	std::string read_string(std::istream& is);
+	std::string read_string(uint8_t const* data, size_t const s);
 	void write_string(std::ostream& os, std::string const& str);
 	void write_string_without_size(std::ostream& os, std::string const& str);
-
-	size_t writing_string_size(std::string const& s);
+	// converts to the LCF codepage
+	std::string encode_string(std::string const& str);
 
 	void set_codepage(unsigned cp);
 }
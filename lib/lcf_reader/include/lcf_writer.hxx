@@ -0,0 +1,59 @@
+#ifndef LCF_WRITER_HXX
+#define LCF_WRITER_HXX
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include <boost/container/vector.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "lcf_reader_fwd.hxx"
+
+namespace LCF {
+	/*
+	 * builds an LCF image in memory in a single pass.
+	 * chunk sizes are patched in when the chunk ends,
+	 * so nothing is measured or converted twice.
+	 */
+	struct writer : boost::noncopyable {
+		writer() {}
+
+		void ber(uint32_t v);
+		void bytes(void const* data, size_t s);
+		void byte(uint8_t v) { data_.push_back(char(v)); }
+		void float_(double v);
+
+		// strings are converted to the LCF codepage here, exactly once
+		void string(std::string const& str);
+		void string_without_size(std::string const& str);
+
+		// little endian integer array
+		template<class T>
+		void array(T const* const data, size_t const s) {
+			size_t const base = data_.size();
+			data_.resize(base + s * sizeof(T));
+			char* dst = data_.data() + base;
+			for(size_t i = 0; i < s; ++i) {
+				for(size_t j = 0; j < sizeof(T); ++j) {
+					*dst++ = (uint32_t(data[i]) >> (8*j)) & 0xffU;
+				}
+			}
+		}
+
+		// writes key and the size of everything written until the matching end_chunk
+		void begin_chunk(uint32_t key);
+		void end_chunk();
+
+		size_t size() const { return data_.size(); }
+		vector<char> const& data() const { return data_; }
+		void write(std::ostream& os) const;
+
+	  private:
+		vector<char> data_;
+		// body positions of open chunks
+		vector<size_t> chunks_;
+	}; // struct writer
+} // namespace LCF
+
+#endif
@@ -5,4 +5,13 @@ module LCF
       self
     end
   end
+
+  class Event
+    include Enumerable
+
+    def each(&block)
+      length.times { |i| block.call self[i] }
+      self
+    end
+  end
 end
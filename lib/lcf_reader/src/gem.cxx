@@ -4,52 +4,43 @@
 #include <mruby/string.h>
 
 #include "binding.hxx"
+#include "lcf_preloader.hxx"
 #include "lcf_reader.hxx"
-#include "lcf_sym.hxx"
+#include "lcf_writer.hxx"
 
+#include <boost/container/flat_map.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 
 namespace EasyRPG {
 
-mrb_value to_mrb(mrb_state* M, LCF::element const& e, picojson_string const& t) {
-	using namespace LCF::sym;
-
-	if(t == integer) {
-		return mrb_fixnum_value(e.i());
-	} else if(t == bool_) {
-		return mrb_bool_value(e.b());
-	} else if(t == float_) {
-		return mrb_float_value(M, e.f());
-	} else if(t == string) {
-		std::string const str = e.s();
-		return mrb_str_new(M, str.data(), str.size());
-	} else if(t == event) {
-		LCF::event ev = e.e();
-		mrb_value const ret = mrb_ary_new_capa(M, ev.size());
-		for(LCF::event::iterator i = ev.begin(); i < ev.end(); ++i) {
-			mrb_ary_push(M, ret, swap(M, *i));
-		}
-		return ret;
-	} else if(t == int8array) { return clone(M, e.i8a());
-	} else if(t == int16array) { return clone(M, e.i16a());
-	} else if(t == int32array) { return clone(M, e.i32a());
-	} else if(t == map_tree) { return clone(M, e.mt());
-	} else if(t == ber_array) { return to_mrb_ary(M, e.ba());
-	} else if(t == array1d) { return clone(M, e.a1d());
-	} else if(t == array2d) { return clone(M, e.a2d());
-	} else {
-		picojson const& sch = LCF::get_schema(t);
-		if(not sch.is<picojson::null>()) {
-			return to_mrb(M, e, sch[type].s());
+mrb_value to_mrb(mrb_state* M, LCF::element const& e) {
+	namespace schema = LCF::schema;
+
+	switch(e.type()) {
+		case schema::integer: return mrb_fixnum_value(e.i());
+		case schema::bool_: return mrb_bool_value(e.b());
+		case schema::float_: return mrb_float_value(M, e.f());
+		case schema::string: {
+			std::string const str = e.s();
+			return mrb_str_new(M, str.data(), str.size());
 		}
-
-		assert(false);
-		return mrb_nil_value();
+		case schema::event: return clone(M, e.e());
+		case schema::int8array: return clone(M, e.i8a());
+		case schema::int16array: return clone(M, e.i16a());
+		case schema::int32array: return clone(M, e.i32a());
+		case schema::map_tree: return clone(M, e.mt());
+		case schema::ber_array: return to_mrb_ary(M, e.ba());
+		case schema::array1d: return clone(M, e.a1d());
+		case schema::array2d: return clone(M, e.a2d());
+		default:
+			assert(false);
+			return mrb_nil_value();
 	}
 }
-mrb_value to_mrb(mrb_state* M, LCF::element const& e) {
-	return to_mrb(M, e, e.type());
-}
 
 mrb_value to_mrb(mrb_state* mrb, picojson::value const& json);
 
@@ -141,16 +132,20 @@ struct array_methods {
 	static mrb_value get(mrb_state* M, mrb_value const self) {
 		mrb_int v;
 		mrb_get_args(M, "i", &v);
-		return mrb_fixnum_value(EasyRPG::get<array_type>(M, self)[v]);
+		array_type const& ary = EasyRPG::get<array_type>(M, self);
+		if(v < 0) { v += ary.size(); }
+		return (v < 0 or size_t(v) >= ary.size())
+				? mrb_nil_value() : mrb_fixnum_value(ary.data()[v]);
 	}
 	static mrb_value length(mrb_state* M, mrb_value const self) {
 		return mrb_fixnum_value(EasyRPG::get<array_type>(M, self).size());
 	}
 	static mrb_value to_ary(mrb_state* M, mrb_value const self) {
 		array_type const& src = EasyRPG::get<array_type>(M, self);
+		T const* const data = src.data();
 		mrb_value const ret = mrb_ary_new_capa(M, src.size());
 		for(size_t i = 0; i < src.size(); ++i) {
-			mrb_ary_push(M, ret, mrb_fixnum_value(src[i]));
+			mrb_ary_push(M, ret, mrb_fixnum_value(data[i]));
 		}
 		return ret;
 	}
@@ -202,12 +197,45 @@ mrb_value lcf_file_error(mrb_state* M, mrb_value const self) {
 	return err.empty()? mrb_nil_value() : to_mrb(M, err);
 }
 
+mrb_value preloader_initialize(mrb_state* M, mrb_value const self) {
+	mrb_int code, arg, threads = 0;
+	mrb_get_args(M, "ii|i", &code, &arg, &threads);
+	new(data_make_struct<LCF::preloader>(M, self)) LCF::preloader(code, arg, threads);
+	return self;
+}
+
+mrb_value preloader_preload(mrb_state* M, mrb_value const self) {
+	mrb_value* ary; mrb_int len;
+	mrb_get_args(M, "a", &ary, &len);
+	LCF::vector<std::string> files;
+	files.reserve(len);
+	for(mrb_int i = 0; i < len; ++i) { files.push_back(to_cxx_str(M, ary[i])); }
+	get<LCF::preloader>(M, self).preload(files);
+	return self;
+}
+
+mrb_value preloader_take(mrb_state* M, mrb_value const self) {
+	char* str; int str_len;
+	mrb_get_args(M, "s", &str, &str_len);
+	LCF::lcf_file file;
+	LCF::vector<int32_t> links;
+	get<LCF::preloader>(M, self).take(std::string(str, str_len), file, links);
+	mrb_value const ret[] = { swap(M, file), to_mrb_ary(M, links) };
+	return mrb_ary_new_from_values(M, 2, ret);
+}
+
+mrb_value preloader_is_loaded(mrb_state* M, mrb_value const self) {
+	char* str; int str_len;
+	mrb_get_args(M, "s", &str, &str_len);
+	return mrb_bool_value(get<LCF::preloader>(M, self).loaded(std::string(str, str_len)));
+}
+
 mrb_value array1d_method_missing(mrb_state* M, mrb_value const self) {
 	mrb_sym sym; size_t str_len;
 	mrb_get_args(M, "n", &sym);
 	char const* const str = mrb_sym2name_len(M, sym, &str_len);
 	boost::optional<LCF::element> const ret =
-			get<LCF::array1d>(M, self).get(picojson_string(str, str_len));
+			get<LCF::array1d>(M, self).get(str, str_len);
 	if(ret) return to_mrb(M, *ret);
 
 	mrb_name_error(M, sym, "%S not found", mrb_sym2str(M, sym));
@@ -225,7 +253,7 @@ mrb_value array1d_get(mrb_state* M, mrb_value const self) {
 		mrb_sym sym; size_t str_len;
 		mrb_get_args(M, "n", &sym);
 		char const* const str = mrb_sym2name_len(M, sym, &str_len);
-		return to_mrb_opt(M, get<LCF::array1d>(M, self).get(picojson_string(str, str_len)));
+		return to_mrb_opt(M, get<LCF::array1d>(M, self).get(str, str_len));
 	}
 }
 
@@ -251,7 +279,7 @@ mrb_value array2d_keys(mrb_state* M, mrb_value const self) {
 	LCF::array2d const& ary2d = get<LCF::array2d>(M, self);
 	mrb_value const ret = mrb_ary_new_capa(M, ary2d.size());
 	for(LCF::array2d::const_iterator i = ary2d.begin(); i != ary2d.end(); ++i) {
-		mrb_ary_push(M, ret, mrb_fixnum_value(i->first));
+		mrb_ary_push(M, ret, mrb_fixnum_value(i->key));
 	}
 	return ret;
 }
@@ -268,31 +296,310 @@ mrb_value map_tree_length(mrb_state* M, mrb_value const self) {
 	return mrb_fixnum_value(get<LCF::map_tree>(M, self).size());
 }
 
+mrb_value event_get(mrb_state* M, mrb_value const self) {
+	mrb_int v;
+	mrb_get_args(M, "i", &v);
+	LCF::event const& ev = get<LCF::event>(M, self);
+	if(v < 0) { v += ev.size(); }
+	return (v < 0 or size_t(v) >= ev.size())? mrb_nil_value() : clone(M, ev[v]);
+}
+mrb_value event_length(mrb_state* M, mrb_value const self) {
+	return mrb_fixnum_value(get<LCF::event>(M, self).size());
+}
+mrb_value event_is_empty(mrb_state* M, mrb_value const self) {
+	return mrb_bool_value(get<LCF::event>(M, self).empty());
+}
+mrb_value event_strings(mrb_state* M, mrb_value const self) {
+	mrb_int code;
+	mrb_get_args(M, "i", &code);
+	LCF::vector<std::string> const& strs = get<LCF::event>(M, self).strings(code);
+	mrb_value const ret = mrb_ary_new_capa(M, strs.size());
+	for(size_t i = 0; i < strs.size(); ++i) { mrb_ary_push(M, ret, to_mrb(M, strs[i])); }
+	return ret;
+}
+// only detaches this object from the commands
+mrb_value event_clear(mrb_state* M, mrb_value const self) {
+	get<LCF::event>(M, self) = LCF::event();
+	return self;
+}
+
 mrb_value event_command_code(mrb_state* M, mrb_value const self) {
-	return mrb_fixnum_value(get<LCF::event_command>(M, self).code);
+	return mrb_fixnum_value(get<LCF::event_command>(M, self).code());
 }
 mrb_value event_command_nest(mrb_state* M, mrb_value const self) {
-	return mrb_fixnum_value(get<LCF::event_command>(M, self).nest);
+	return mrb_fixnum_value(get<LCF::event_command>(M, self).nest());
 }
 mrb_value event_command_str(mrb_state* M, mrb_value const self) {
-	return to_mrb(M, get<LCF::event_command>(M, self).str);
+	return to_mrb(M, get<LCF::event_command>(M, self).str());
 }
 mrb_value event_command_args(mrb_state* M, mrb_value const self) {
-	return to_mrb_ary(M, get<LCF::event_command>(M, self).args);
+	LCF::event_command const& cmd = get<LCF::event_command>(M, self);
+	mrb_value const ret = mrb_ary_new_capa(M, cmd.args_size());
+	for(size_t i = 0; i < cmd.args_size(); ++i) {
+		mrb_ary_push(M, ret, mrb_fixnum_value(cmd.arg(i)));
+	}
+	return ret;
 }
 mrb_value event_command_get(mrb_state* M, mrb_value const self) {
 	mrb_int v;
 	mrb_get_args(M, "i", &v);
-	return mrb_fixnum_value(get<LCF::event_command>(M, self).args[v]);
+	LCF::event_command const& cmd = get<LCF::event_command>(M, self);
+	if(v < 0) { v += cmd.args_size(); }
+	return (v < 0 or size_t(v) >= cmd.args_size())
+			? mrb_nil_value() : mrb_fixnum_value(cmd.arg(v));
+}
+
+/*
+ * LCF writer driven straight from ruby values, without building picojson.
+ * Hash keys may be symbols or strings, loaded LCF::Array1d and
+ * LCF::Array2d values are copied from their file as is.
+ */
+namespace schema = LCF::schema;
+
+mrb_value hash_get(mrb_state* M, mrb_value const h, char const* const key) {
+	mrb_value const ret = mrb_hash_get(M, h, mrb_symbol_value(mrb_intern_cstr(M, key)));
+	return mrb_nil_p(ret)? mrb_hash_get(M, h, mrb_str_new_cstr(M, key)) : ret;
+}
+
+mrb_int to_lcf_int(mrb_state* M, mrb_value const v) {
+	switch(mrb_type(v)) {
+		case MRB_TT_TRUE: return 1;
+		case MRB_TT_FALSE: return 0;
+		default: return mrb_fixnum(mrb_Integer(M, v));
+	}
+}
+
+bool is_default(schema::field const& f, mrb_value const v) {
+	if(not f.has_default) { return false; }
+
+	switch(f.type) {
+		case schema::integer:
+			return mrb_fixnum_p(v) and mrb_fixnum(v) == f.int_value;
+		case schema::bool_:
+			return (mrb_type(v) == MRB_TT_TRUE or mrb_type(v) == MRB_TT_FALSE)
+					and mrb_test(v) == bool(f.int_value);
+		case schema::float_:
+			return (mrb_float_p(v) and mrb_float(v) == f.float_value)
+					or (mrb_fixnum_p(v) and mrb_fixnum(v) == f.float_value);
+		case schema::string:
+			return mrb_string_p(v) and size_t(RSTRING_LEN(v)) == std::strlen(f.string_value)
+					and std::memcmp(RSTRING_PTR(v), f.string_value, RSTRING_LEN(v)) == 0;
+		default: return false;
+	}
+}
+
+// index of an array2d row or an unknown chunk
+uint32_t to_index(mrb_state* M, mrb_value const k) {
+	if(mrb_fixnum_p(k)) { return mrb_fixnum(k); }
+
+	std::string const str = to_cxx_str(M, k);
+	char* end;
+	unsigned long const ret = std::strtoul(str.c_str(), &end, 10);
+	if(str.empty() or *end != '\0') {
+		mrb_raisef(M, mrb_class_get(M, "ArgumentError"), "invalid LCF key: %S", k);
+	}
+	return ret;
+}
+
+template<class T>
+void save_int_array(mrb_state* M, LCF::writer& w, mrb_value const v) {
+	if(is<LCF::detail::array<T> >(M, v)) {
+		LCF::detail::array<T> const& ary = get<LCF::detail::array<T> >(M, v);
+		w.array(ary.data(), ary.size());
+		return;
+	}
+
+	mrb_value const ary = mrb_check_array_type(M, v);
+	if(mrb_nil_p(ary)) {
+		mrb_raisef(M, mrb_class_get(M, "TypeError"), "not an array: %S", v);
+	}
+	for(mrb_int i = 0; i < RARRAY_LEN(ary); ++i) {
+		T const val = to_lcf_int(M, RARRAY_PTR(ary)[i]);
+		w.array(&val, 1);
+	}
+}
+
+void save_ber_array(mrb_state* M, LCF::writer& w, mrb_value const v) {
+	mrb_value const ary = mrb_check_array_type(M, v);
+	if(mrb_nil_p(ary)) {
+		mrb_raisef(M, mrb_class_get(M, "TypeError"), "not an array: %S", v);
+	}
+	for(mrb_int i = 0; i < RARRAY_LEN(ary); ++i) {
+		w.ber(to_lcf_int(M, RARRAY_PTR(ary)[i]));
+	}
+}
+
+void save_event(mrb_state* M, LCF::writer& w, mrb_value const v) {
+	if(is<LCF::event>(M, v)) { return get<LCF::event>(M, v).write(w); }
+
+	mrb_value const ary = mrb_check_array_type(M, v);
+	if(mrb_nil_p(ary)) {
+		mrb_raisef(M, mrb_class_get(M, "TypeError"), "not an array: %S", v);
+	}
+	for(mrb_int i = 0; i < RARRAY_LEN(ary); ++i) {
+		mrb_value const cmd = RARRAY_PTR(ary)[i];
+		if(is<LCF::event_command>(M, cmd)) {
+			get<LCF::event_command>(M, cmd).write(w);
+		} else {
+			w.ber(to_lcf_int(M, hash_get(M, cmd, "code")));
+			w.ber(to_lcf_int(M, hash_get(M, cmd, "nest")));
+			w.string(to_cxx_str(M, hash_get(M, cmd, "string")));
+			mrb_value const args = mrb_check_array_type(M, hash_get(M, cmd, "args"));
+			w.ber(mrb_nil_p(args)? 0 : RARRAY_LEN(args));
+			if(not mrb_nil_p(args)) { save_ber_array(M, w, args); }
+		}
+	}
+}
+
+void save_element(mrb_state* M, LCF::writer& w, mrb_value v, schema::field const& f);
+
+void save_array1d(mrb_state* M, LCF::writer& w, mrb_value const v, schema::table const& t) {
+	if(is<LCF::array1d>(M, v)) { return get<LCF::array1d>(M, v).write(w); }
+
+	typedef std::pair<schema::field const*, mrb_value> entry;
+	typedef boost::container::flat_map<uint32_t, entry> sorted_type;
+
+	mrb_value const keys = mrb_hash_keys(M, v);
+	sorted_type sorted;
+	sorted.reserve(RARRAY_LEN(keys));
+	for(mrb_int i = 0; i < RARRAY_LEN(keys); ++i) {
+		mrb_value const k = RARRAY_PTR(keys)[i];
+
+		schema::field const* f = NULL;
+		if(mrb_symbol_p(k)) {
+			size_t len;
+			char const* const name = mrb_sym2name_len(M, mrb_symbol(k), &len);
+			f = schema::find(t, name, len);
+		} else if(mrb_string_p(k)) {
+			f = schema::find(t, RSTRING_PTR(k), RSTRING_LEN(k));
+		}
+		if(not f and to_cxx_str(M, k) == "_rest") { continue; }
+
+		uint32_t const idx = f? f->index : to_index(M, k);
+		sorted.insert(sorted_type::value_type(idx, entry(f, mrb_hash_get(M, v, k))));
+	}
+
+	for(sorted_type::const_iterator i = sorted.begin(); i != sorted.end(); ++i) {
+		schema::field const* const f = i->second.first;
+		mrb_value const val = i->second.second;
+
+		// unknown chunk, raw bytes
+		if(not f) {
+			w.begin_chunk(i->first);
+			save_int_array<uint8_t>(M, w, val);
+			w.end_chunk();
+			continue;
+		}
+
+		if(is_default(*f, val)) { continue; }
+
+		w.begin_chunk(i->first);
+		save_element(M, w, val, *f);
+		w.end_chunk();
+	}
+	w.ber(0);
+}
+
+void save_array2d(mrb_state* M, LCF::writer& w, mrb_value const v, schema::table const& t) {
+	if(is<LCF::array2d>(M, v)) { return get<LCF::array2d>(M, v).write(w); }
+
+	typedef boost::container::flat_multimap<uint32_t, mrb_value> sorted_type;
+
+	mrb_value const keys = mrb_hash_keys(M, v);
+	sorted_type sorted;
+	sorted.reserve(RARRAY_LEN(keys));
+	for(mrb_int i = 0; i < RARRAY_LEN(keys); ++i) {
+		mrb_value const k = RARRAY_PTR(keys)[i];
+		uint32_t const idx = to_index(M, k);
+		mrb_value const row = mrb_hash_get(M, v, k);
+		sorted.insert(sorted_type::value_type(idx, row));
+
+		// _rest
+		if(not mrb_hash_p(row)) { continue; }
+		mrb_value const rest = mrb_check_array_type(M, hash_get(M, row, "_rest"));
+		if(mrb_nil_p(rest)) { continue; }
+		for(mrb_int r = 0; r < RARRAY_LEN(rest); ++r) {
+			sorted.insert(sorted_type::value_type(idx, RARRAY_PTR(rest)[r]));
+		}
+	}
+
+	w.ber(sorted.size());
+	for(sorted_type::const_iterator i = sorted.begin(); i != sorted.end(); ++i) {
+		w.ber(i->first);
+		save_array1d(M, w, i->second, t);
+	}
+}
+
+void save_element(mrb_state* M, LCF::writer& w, mrb_value const v, schema::field const& f) {
+	switch(f.type) {
+		case schema::integer: w.ber(to_lcf_int(M, v)); break;
+		case schema::bool_: w.ber(mrb_test(v)); break;
+		case schema::float_: w.float_(mrb_float(mrb_Float(M, v))); break;
+		case schema::string: w.string_without_size(to_cxx_str(M, v)); break;
+		case schema::event: save_event(M, w, v); break;
+		case schema::int8array: save_int_array<uint8_t>(M, w, v); break;
+		case schema::int16array: save_int_array<int16_t>(M, w, v); break;
+		case schema::int32array: save_int_array<int32_t>(M, w, v); break;
+		case schema::ber_array: save_ber_array(M, w, v); break;
+		case schema::array1d: save_array1d(M, w, v, *f.value); break;
+		case schema::array2d: save_array2d(M, w, v, *f.value); break;
+		case schema::map_tree:
+			if(is<LCF::map_tree>(M, v)) {
+				LCF::map_tree const& t = get<LCF::map_tree>(M, v);
+				w.ber(t.size());
+				for(size_t i = 0; i < t.size(); ++i) { w.ber(t[i]); }
+				w.ber(t.active_node);
+			} else {
+				mrb_value const nodes = mrb_check_array_type(M, hash_get(M, v, "nodes"));
+				w.ber(mrb_nil_p(nodes)? 0 : RARRAY_LEN(nodes));
+				if(not mrb_nil_p(nodes)) { save_ber_array(M, w, nodes); }
+				w.ber(to_lcf_int(M, hash_get(M, v, "active_node")));
+			}
+			break;
+		default: assert(false); break;
+	}
 }
 
 mrb_value save_lcf(mrb_state* M, mrb_value) {
 	mrb_value v; char* str;
 	mrb_get_args(M, "oz", &v, &str);
-	picojson json;
-	to_cxx(M, v, json);
-	std::ofstream ofs(str, std::ios::out | std::ios::binary);
-	return mrb_bool_value(LCF::save_lcf(json, ofs));
+
+	std::string const signature = to_cxx_str(M, hash_get(M, v, "signature"));
+	schema::file const* const file = schema::find_file(signature.data(), signature.size());
+	if(not file) {
+		mrb_raisef(M, mrb_class_get(M, "ArgumentError"), "unknown LCF signature: %S",
+				   to_mrb(M, signature));
+	}
+
+	mrb_value const root = mrb_check_array_type(M, hash_get(M, v, "root"));
+	if(mrb_nil_p(root) or size_t(RARRAY_LEN(root)) != file->root_count) {
+		mrb_raisef(M, mrb_class_get(M, "ArgumentError"), "invalid LCF root of %S",
+				   to_mrb(M, signature));
+	}
+
+	// the file is only touched after the whole image is built
+	LCF::writer w;
+	w.string(signature);
+	for(size_t i = 0; i < file->root_count; ++i) {
+		save_element(M, w, RARRAY_PTR(root)[i], file->root[i]);
+	}
+
+	/*
+	 * replace the file at once, so a failed write never leaves a broken file
+	 * and lcf_file instances mapping the old one keep their contents
+	 */
+	std::string const tmp = std::string(str) + ".tmp";
+	std::ofstream ofs(tmp.c_str(), std::ios::out | std::ios::binary);
+	w.write(ofs);
+	ofs.close();
+	if(not ofs) {
+		std::remove(tmp.c_str());
+		return mrb_false_value();
+	}
+#ifdef _WIN32
+	std::remove(str);
+#endif
+	return mrb_bool_value(std::rename(tmp.c_str(), str) == 0);
 }
 
 }
@@ -313,6 +620,14 @@ extern "C" void mrb_lcf_reader_gem_init(mrb_state* M) {
 		method_info_end };
 	register_methods(M, define_class<LCF::lcf_file>(M, "LcfFile", mod), lcf_file_methods);
 
+	static method_info const preloader_methods[] = {
+		{ "initialize", &preloader_initialize, MRB_ARGS_REQ(2) | MRB_ARGS_OPT(1) },
+		{ "preload", &preloader_preload, MRB_ARGS_REQ(1) },
+		{ "take", &preloader_take, MRB_ARGS_REQ(1) },
+		{ "loaded?", &preloader_is_loaded, MRB_ARGS_REQ(1) },
+		method_info_end };
+	register_methods(M, define_class<LCF::preloader>(M, "Preloader", mod), preloader_methods);
+
 	static method_info const array1d_methods[] = {
 		{ "method_missing", &array1d_method_missing, MRB_ARGS_REQ(1) | MRB_ARGS_REST() },
 		{ "[]", &array1d_get, MRB_ARGS_REQ(1) },
@@ -341,11 +656,25 @@ extern "C" void mrb_lcf_reader_gem_init(mrb_state* M) {
 	array_methods<int16_t>::register_(M, mod, "int16_array");
 	array_methods<int32_t>::register_(M, mod, "int32_array");
 
+	static method_info const event_methods[] = {
+		{ "[]", &event_get, MRB_ARGS_REQ(1) },
+		{ "length", &event_length, MRB_ARGS_NONE() },
+		{ "size", &event_length, MRB_ARGS_NONE() },
+		{ "empty?", &event_is_empty, MRB_ARGS_NONE() },
+		{ "strings", &event_strings, MRB_ARGS_REQ(1) },
+		{ "clear", &event_clear, MRB_ARGS_NONE() },
+		method_info_end };
+	register_methods(M, define_class<LCF::event>(M, "Event", mod), event_methods);
+
+	// indent, string and parameters are the names the interpreter uses
 	static method_info const event_command_methods[] = {
 		{ "code", &event_command_code, MRB_ARGS_NONE() },
 		{ "nest", &event_command_nest, MRB_ARGS_NONE() },
+		{ "indent", &event_command_nest, MRB_ARGS_NONE() },
 		{ "str", &event_command_str, MRB_ARGS_NONE() },
+		{ "string", &event_command_str, MRB_ARGS_NONE() },
 		{ "args", &event_command_args, MRB_ARGS_NONE() },
+		{ "parameters", &event_command_args, MRB_ARGS_NONE() },
 		{ "[]", &event_command_get, MRB_ARGS_REQ(1) },
 		method_info_end };
 	register_methods(M, define_class<LCF::event_command>(M, "EventCommand", mod),
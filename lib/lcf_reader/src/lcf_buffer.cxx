@@ -0,0 +1,105 @@
+#include "lcf_buffer.hxx"
+#include "lcf_stream.hxx"
+
+#include <fstream>
+#include <istream>
+#include <iterator>
+
+#include <boost/assert.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+LCF::buffer::buffer() : data_(NULL), size_(0), mapped_(NULL) {}
+
+LCF::buffer::~buffer() {
+#ifndef _WIN32
+	if(mapped_) { BOOST_VERIFY(::munmap(mapped_, size_) == 0); }
+#endif
+}
+
+LCF::buffer_ref LCF::buffer::own(vector<char>& data) {
+	std::shared_ptr<buffer> const ret(new buffer());
+	ret->owned_.swap(data);
+	ret->data_ = reinterpret_cast<uint8_t const*>(ret->owned_.data());
+	ret->size_ = ret->owned_.size();
+	return ret;
+}
+
+LCF::buffer_ref LCF::buffer::read(std::istream& is) {
+	vector<char> tmp;
+
+	std::istream::pos_type const cur = is.tellg();
+	is.seekg(0, std::ios::end);
+	std::istream::pos_type const end = is.tellg();
+	if(cur != std::istream::pos_type(-1) and end != std::istream::pos_type(-1)) {
+		is.seekg(cur);
+		tmp.resize(size_t(end - cur));
+		is.read(tmp.data(), tmp.size());
+	} else {
+		// not seekable
+		is.clear();
+		tmp.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+	}
+
+	return own(tmp);
+}
+
+LCF::buffer_ref LCF::buffer::map(std::string const& file) {
+#ifndef _WIN32
+	int const fd = ::open(file.c_str(), O_RDONLY);
+	if(fd == -1) { return buffer_ref(); }
+
+	struct stat st;
+	void* const p = (::fstat(fd, &st) == 0 and st.st_size > 0)
+			? ::mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+	::close(fd);
+
+	if(p != MAP_FAILED) {
+		std::shared_ptr<buffer> const ret(new buffer());
+		ret->mapped_ = p;
+		ret->data_ = static_cast<uint8_t const*>(p);
+		ret->size_ = st.st_size;
+		return ret;
+	}
+	// fall back to reading the whole file
+#endif
+
+	std::ifstream ifs(file.c_str(), std::ios::binary | std::ios::in);
+	if(not ifs) { return buffer_ref(); }
+	return read(ifs);
+}
+
+std::string const& LCF::buffer::string(size_t const base, size_t const s) const {
+	if(base > size_ or s > size_ - base) {
+		static std::string const empty;
+		return empty;
+	}
+	boost::string_ref const key(reinterpret_cast<char const*>(data_ + base), s);
+	std::unordered_map<boost::string_ref, std::string, detail::string_ref_hash>::const_iterator const
+			i = strings_.find(key);
+	if(i != strings_.end()) { return i->second; }
+	return strings_.insert(std::make_pair(key, read_string(data_ + base, s))).first->second;
+}
+
+uint32_t LCF::cursor::ber() {
+	if(eof()) {
+		good_ = false;
+		return 0;
+	}
+	return LCF::ber(cur_, end_);
+}
+
+std::string LCF::cursor::string(size_t const s) {
+	size_t const pos = tell();
+	skip(s);
+	return good_? buffer_->string(pos, s) : std::string();
+}
+
+std::string LCF::cursor::string() {
+	return string(ber());
+}
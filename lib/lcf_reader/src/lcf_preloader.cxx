@@ -0,0 +1,161 @@
+#include "lcf_preloader.hxx"
+
+#include <algorithm>
+#include <exception>
+
+namespace {
+
+struct link_scanner {
+	uint32_t code;
+	size_t arg;
+	LCF::vector<int32_t>& links;
+
+	void operator()(LCF::array1d const& a) const {
+		for(LCF::array1d::const_iterator i = a.begin(); i < a.end(); ++i) {
+			(*this)(a.at(i));
+		}
+	}
+
+	// touches everything the main thread would decode lazily
+	void operator()(LCF::element const& e) const {
+		if(not e.exists()) { return; }
+
+		switch(e.type()) {
+			case LCF::schema::array1d: (*this)(e.a1d()); break;
+			case LCF::schema::array2d: {
+				LCF::array2d const a = e.a2d();
+				for(LCF::array2d::const_iterator i = a.begin(); i < a.end(); ++i) {
+					(*this)(a.at(i));
+				}
+			} break;
+			case LCF::schema::event: {
+				LCF::event const ev = e.e();
+				for(size_t i = 0; i < ev.size(); ++i) {
+					LCF::event_command const cmd = ev[i];
+					if(cmd.code() == code and arg < cmd.args_size()) {
+						links.push_back(cmd.arg(arg));
+					}
+				}
+			} break;
+			case LCF::schema::int8array: (void)e.i8a(); break;
+			case LCF::schema::int16array: (void)e.i16a(); break;
+			case LCF::schema::int32array: (void)e.i32a(); break;
+			default: break;
+		}
+	}
+};
+
+}
+
+LCF::preloader::preloader(uint32_t const link_code, size_t const link_arg, size_t threads)
+		: link_code_(link_code), link_arg_(link_arg), quit_(false)
+{
+	if(threads == 0) {
+		// leave a core to the main thread
+		unsigned const cores = std::thread::hardware_concurrency();
+		threads = std::min(2U, std::max(2U, cores) - 1);
+	}
+	for(size_t i = 0; i < threads; ++i) {
+		workers_.push_back(std::thread(&preloader::work, this));
+	}
+}
+
+LCF::preloader::~preloader() {
+	{
+		std::lock_guard<std::mutex> const lock(mutex_);
+		quit_ = true;
+	}
+	queued_.notify_all();
+	for(size_t i = 0; i < workers_.size(); ++i) { workers_[i].join(); }
+}
+
+void LCF::preloader::preload(vector<std::string> const& files) {
+	{
+		std::lock_guard<std::mutex> const lock(mutex_);
+		std::map<std::string, entry_ref> next;
+		queue_.clear();
+
+		for(size_t i = 0; i < files.size(); ++i) {
+			std::string const& f = files[i];
+			if(f.empty() or next.count(f)) { continue; }
+
+			std::map<std::string, entry_ref>::const_iterator const cur = entries_.find(f);
+			if(cur != entries_.end() and cur->second->state != entry::queued) {
+				next[f] = cur->second;
+				continue;
+			}
+			next[f] = std::make_shared<entry>();
+			queue_.push_back(f);
+		}
+		// workers keep files being loaded alive until they finish
+		entries_.swap(next);
+	}
+	queued_.notify_all();
+}
+
+void LCF::preloader::take(std::string const& file, lcf_file& ret, vector<int32_t>& links) {
+	entry_ref e;
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		std::map<std::string, entry_ref>::iterator const i = entries_.find(file);
+		if(i != entries_.end()) {
+			e = i->second;
+			entries_.erase(i);
+
+			if(e->state == entry::queued) {
+				queue_.erase(std::find(queue_.begin(), queue_.end(), file));
+				e.reset();
+			} else {
+				done_.wait(lock, [&e] { return e->state == entry::done or e->state == entry::failed; });
+				if(e->state == entry::failed) { e.reset(); }
+			}
+		}
+	}
+
+	// errors are reported by the caller as usual when loaded here
+	if(not e) {
+		e = std::make_shared<entry>();
+		load(file, *e);
+	}
+	ret.swap(e->file);
+	links.swap(e->links);
+}
+
+bool LCF::preloader::loaded(std::string const& file) const {
+	std::lock_guard<std::mutex> const lock(mutex_);
+	std::map<std::string, entry_ref>::const_iterator const i = entries_.find(file);
+	return i != entries_.end() and i->second->state == entry::done;
+}
+
+void LCF::preloader::work() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	for(;;) {
+		queued_.wait(lock, [this] { return quit_ or not queue_.empty(); });
+		if(quit_) { return; }
+
+		std::string const file = queue_.front();
+		queue_.pop_front();
+		entry_ref const e = entries_[file];
+		e->state = entry::loading;
+
+		lock.unlock();
+		entry::state_t state = entry::done;
+		try { load(file, *e); }
+		catch(std::exception const&) { state = entry::failed; }
+		lock.lock();
+
+		e->state = state;
+		done_.notify_all();
+	}
+}
+
+void LCF::preloader::load(std::string const& file, entry& e) const {
+	lcf_file(file).swap(e.file);
+	if(not e.file.valid()) { return; }
+
+	link_scanner const scan = { link_code_, link_arg_, e.links };
+	for(size_t i = 0; i < e.file.root_count(); ++i) { scan(e.file.root(i)); }
+
+	std::sort(e.links.begin(), e.links.end());
+	e.links.erase(std::unique(e.links.begin(), e.links.end()), e.links.end());
+}
@@ -1,6 +1,8 @@
 #include "lcf_reader.hxx"
+#include "lcf_buffer.hxx"
 #include "lcf_stream.hxx"
 #include "lcf_sym.hxx"
+#include "lcf_writer.hxx"
 #include "picojson.hxx"
 
 #include <boost/bind.hpp>
@@ -15,13 +17,12 @@
 #include <boost/optional.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <iterator>
 
 
-extern char const* LCF_SCHEMA_JSON_STRING[];
-
 namespace {
 std::ios::openmode const write_flag = std::ios::binary | std::ios::out;
 std::ios::openmode const read_flag = std::ios::binary | std::ios::in;
@@ -34,199 +35,326 @@ using boost::ref;
 namespace sym = LCF::sym;
 }
 
-void LCF::event_command::swap(event_command& e) {
-	std::swap(code, e.code);
-	std::swap(nest, e.nest);
-	str.swap(e.str);
-	args.swap(e.args);
-}
+struct LCF::detail::event_data {
+	struct command {
+		uint32_t code, nest;
+		// string in buffer
+		uint32_t str_base, str_size;
+		// arguments in args
+		uint32_t args_begin, args_size;
+	};
+
+	LCF::buffer const* buffer;
+	size_t base, size;
+	vector<command> commands;
+	vector<int32_t> args;
+	// by command code, filled on request
+	mutable boost::container::flat_map<uint32_t, vector<std::string> > strings;
+};
+
+LCF::event::event(buffer_ref const& buf, cursor& c, size_t const end) {
+	buffer_ = buf;
+	data_ref& cache = buf->event_data(c.tell());
+	if(cache) {
+		c.seek(cache->base + cache->size);
+		data_ = cache;
+		return;
+	}
+
+	std::shared_ptr<data> const d = std::make_shared<data>();
+	d->buffer = buf.get();
+	d->base = c.tell();
+
+	while(c.tell() < end and c.good()) {
+		data::command cmd;
+		cmd.code = c.ber();
+		cmd.nest = c.ber();
+		cmd.str_size = c.ber();
+		cmd.str_base = c.tell();
+		c.skip(cmd.str_size);
+
+		cmd.args_size = c.ber();
+		cmd.args_begin = d->args.size();
+		for(size_t i = 0; i < cmd.args_size and c.good(); ++i) {
+			d->args.push_back(c.ber());
+		}
+		d->commands.push_back(cmd);
+	}
+	d->size = c.tell() - d->base;
 
-picojson const& LCF::get_schema(picojson::string const& name) {
-	typedef boost::container::flat_map<picojson::string, picojson> cache_type;
-	static cache_type cache_;
+	data_ = cache = d;
+}
 
-	if(cache_.empty()) {
-		for(char const** src = LCF_SCHEMA_JSON_STRING; *src != NULL; ++src) {
-			picojson json;
-			char const* src_ = *src;
-			std::string const err = picojson::parse(json, src_, src_ + strlen(src_));
+size_t LCF::event::size() const {
+	return data_? data_->commands.size() : 0;
+}
 
-			assert(err.empty());
+LCF::event_command LCF::event::operator[](size_t const idx) const {
+	assert(idx < size());
+	return event_command(buffer_, data_, idx);
+}
 
-			picojson::string const& key =
-					json.contains(sym::signature)? json[sym::signature].s():
-					json.contains(sym::name)? json[sym::name].s():
-					picojson::string("");
+LCF::vector<std::string> const& LCF::event::strings(uint32_t const code) const {
+	static vector<std::string> const empty;
+	if(not data_) { return empty; }
 
-			assert(not name.get().empty());
-			assert(cache_.find(key) == cache_.end());
+	typedef boost::container::flat_map<uint32_t, vector<std::string> > strings_type;
+	strings_type::iterator i = data_->strings.find(code);
+	if(i != data_->strings.end()) { return i->second; }
 
-			cache_[key].swap(json);
+	i = data_->strings.insert(std::make_pair(code, vector<std::string>())).first;
+	for(size_t idx = 0; idx < size(); ++idx) {
+		data::command const& cmd = data_->commands[idx];
+		if(cmd.code == code) {
+			i->second.push_back(data_->buffer->string(cmd.str_base, cmd.str_size));
 		}
 	}
+	return i->second;
+}
 
-	cache_type::const_iterator const i = cache_.find(name);
-	static picojson const null_;
-	return (i != cache_.end())? i->second : null_;
-}
-
-bool LCF::has_default(picojson const& sch) {
-	picojson::string const& type_name = sch[sym::type].s();
-	return sch.contains(sym::value)
-			and not sch[sym::value].is<picojson::array>()
-			and type_name != sym::array1d
-			and type_name != sym::array2d
-			;
-}
-
-picojson const& LCF::actual_schema(picojson const& sch, picojson::string const& type) {
-	picojson const& val = sch[sym::value];
-	picojson::string const& type_name = sch[sym::type].s();
-	if(val.is<picojson::array>()) {
-		assert(type_name == type);
-		return sch;
-	} else {
-		picojson const& t = get_schema(type_name);
-		if(not t.is<picojson::null>()) {
-			assert(t[sym::type].s() == type);
-			return t;
-		} else {
-			assert(type_name == type);
-			picojson const& ret = get_schema(val.s());
-
-			return ret;
-		}
+void LCF::event::write(writer& w) const {
+	if(data_) { w.bytes(data_->buffer->data() + data_->base, data_->size); }
+}
+
+uint32_t LCF::event_command::code() const {
+	return data_->commands[index_].code;
+}
+uint32_t LCF::event_command::nest() const {
+	return data_->commands[index_].nest;
+}
+std::string LCF::event_command::str() const {
+	event::data::command const& cmd = data_->commands[index_];
+	return data_->buffer->string(cmd.str_base, cmd.str_size);
+}
+
+size_t LCF::event_command::args_size() const {
+	return data_->commands[index_].args_size;
+}
+int32_t const* LCF::event_command::args() const {
+	return data_->args.data() + data_->commands[index_].args_begin;
+}
+int32_t LCF::event_command::arg(size_t const idx) const {
+	assert(idx < args_size());
+	return args()[idx];
+}
+
+void LCF::event_command::write(writer& w) const {
+	event::data::command const& cmd = data_->commands[index_];
+	w.ber(cmd.code);
+	w.ber(cmd.nest);
+	w.ber(cmd.str_size);
+	w.bytes(data_->buffer->data() + cmd.str_base, cmd.str_size);
+	w.ber(cmd.args_size);
+	for(size_t i = 0; i < cmd.args_size; ++i) { w.ber(args()[i]); }
+}
+
+namespace {
+
+using LCF::detail::chunk;
+using LCF::detail::chunk_index;
+using LCF::detail::chunk_index_ref;
+
+bool chunk_less(chunk const& lhs, chunk const& rhs) { return lhs.key < rhs.key; }
+bool chunk_key_less(chunk const& lhs, uint32_t const k) { return lhs.key < k; }
+bool chunk_key_equal(chunk const& lhs, chunk const& rhs) { return lhs.key == rhs.key; }
+
+chunk_index_ref const& empty_chunks() {
+	static chunk_index_ref const ret = std::make_shared<chunk_index>();
+	return ret;
+}
+
+// keys are sorted in valid files, keep the first of duplicated keys like a map
+void sort_chunks(LCF::vector<chunk>& chunks, bool const unique) {
+	if(not std::is_sorted(chunks.begin(), chunks.end(), chunk_less)) {
+		std::stable_sort(chunks.begin(), chunks.end(), chunk_less);
+	}
+	if(unique) {
+		chunks.erase(std::unique(chunks.begin(), chunks.end(), chunk_key_equal), chunks.end());
 	}
 }
 
-picojson const& LCF::find_schema(picojson const& sch, uint32_t const k) {
-	picojson::array const& ary = sch[sym::value].a();
-	for(picojson::array::const_iterator i = ary.begin(); i != ary.end(); ++i) {
-		if((*i)[sym::index].i() == int(k)) { return *i; }
+chunk_index_ref index_array1d(LCF::schema::table const& t, LCF::buffer const& buf, LCF::cursor& c) {
+	chunk_index_ref& cache = buf.chunk_index(c.tell());
+	if(cache) {
+		c.skip(cache->size);
+		return cache;
 	}
 
-	static picojson const null_;
-	return null_;
-}
+	std::shared_ptr<chunk_index> const ret = std::make_shared<chunk_index>();
+	size_t const base = c.tell();
+	ret->chunks.reserve(t.field_count);
+
+	uint32_t prev_idx = 0;
+
+	while(not c.eof() and c.good()) {
+		uint32_t const idx = c.ber();
+		if(idx == 0) { break; }
+
+		// check previous index
+		assert(prev_idx <= idx);
+		prev_idx = idx;
 
-picojson const& LCF::find_schema(picojson const& sch, picojson::string const& k) {
-	picojson::array const& ary = sch[sym::value].a();
-	for(picojson::array::const_iterator i = ary.begin(); i != ary.end(); ++i) {
-		if((*i)[sym::name].s() == k) { return *i; }
+		size_t const s = c.ber();
+		// drop chunks running past the end, the cursor becomes bad
+		if(s > c.remaining()) {
+			c.skip(s);
+			break;
+		}
+		LCF::schema::field const* const f = LCF::schema::find(t, idx);
+		chunk const ch = { idx, c.tell(), s, f? f : &LCF::schema::unknown_field };
+		ret->chunks.push_back(ch);
+		c.skip(s);
 	}
+	ret->base = base;
+	ret->size = c.tell() - base;
+	sort_chunks(ret->chunks, true);
 
-	static picojson const null_;
-	return null_;
+	return cache = ret;
 }
 
-LCF::array2d::array2d() : base_(0), size_(0), schema_(NULL) {}
-LCF::array2d::array2d(array2d const& r)
-		: detail::array2d_base(r), stream_(r.stream_)
-		, base_(r.base_), size_(r.size_), schema_(r.schema_) {}
+chunk_index_ref index_array2d(LCF::schema::table const& t, LCF::buffer const& buf, LCF::cursor& c) {
+	chunk_index_ref& cache = buf.chunk_index(c.tell());
+	if(cache) {
+		c.skip(cache->size);
+		return cache;
+	}
 
-LCF::array2d::array2d(picojson const& sch, istream_ref const& is)
-		: stream_(is), base_(is->tellg()), size_(0), schema_(&sch)
-{
-	size_t const elem_num = ber(*stream_);
-	reserve(elem_num);
+	std::shared_ptr<chunk_index> const ret = std::make_shared<chunk_index>();
+	size_t const base = c.tell();
+
+	size_t const elem_num = c.ber();
+	// every row takes two bytes at least
+	ret->chunks.reserve(std::min(elem_num, c.remaining() / 2));
 
 	uint32_t prev_idx = 0;
-	for(size_t i = 0; i < elem_num; ++i) {
-		uint32_t const idx = ber(*stream_);
-		insert(value_type(idx, array1d(*schema_, stream_)));
+	for(size_t i = 0; i < elem_num and c.good(); ++i) {
+		uint32_t const idx = c.ber();
+		size_t const row_base = c.tell();
+		// rows are indexed too, their size is only known after scanning
+		chunk const ch = { idx, row_base, index_array1d(t, buf, c)->size, NULL };
+		ret->chunks.push_back(ch);
 
 		// check previous index
 		assert(prev_idx <= idx);
 		prev_idx = idx;
 	}
+	ret->base = base;
+	ret->size = c.tell() - base;
+	sort_chunks(ret->chunks, false);
+
+	// the unordered_map is node based, so cache is still valid here
+	return cache = ret;
+}
 
-	size_ = size_t(is->tellg()) - base_;
 }
 
-boost::optional<LCF::array1d const&> LCF::array2d::get(uint32_t const k) const {
-	const_iterator i = find(k);
-	if(i != end()) { return i->second; }
+LCF::array2d::array2d() : chunks_(empty_chunks()), table_(NULL) {}
+LCF::array2d::array2d(array2d const& r)
+		: buffer_(r.buffer_), chunks_(r.chunks_), table_(r.table_) {}
+
+LCF::array2d::array2d(schema::table const& t, buffer_ref const& buf, cursor& c)
+		: buffer_(buf), chunks_(index_array2d(t, *buf, c)), table_(&t) {}
+
+LCF::array2d::const_iterator LCF::array2d::begin() const { return chunks_->chunks.begin(); }
+LCF::array2d::const_iterator LCF::array2d::end() const { return chunks_->chunks.end(); }
+size_t LCF::array2d::size() const { return chunks_->chunks.size(); }
+
+LCF::array1d LCF::array2d::at(const_iterator const i) const {
+	cursor c(*buffer_, i->base);
+	return array1d(*table_, buffer_, c, i->key);
+}
+
+boost::optional<LCF::array1d> LCF::array2d::get(uint32_t const k) const {
+	const_iterator const i = std::lower_bound(begin(), end(), k, chunk_key_less);
+	if(i != end() and i->key == k) { return at(i); }
 	else { return boost::none; }
 }
-LCF::array1d const& LCF::array2d::operator[](uint32_t const k) const {
-	const_iterator i = find(k);
-	assert(i != end());
-	return i->second;
+LCF::array1d LCF::array2d::operator[](uint32_t const k) const {
+	const_iterator const i = std::lower_bound(begin(), end(), k, chunk_key_less);
+	assert(i != end() and i->key == k);
+	return at(i);
+}
+
+void LCF::array2d::write(writer& w) const {
+	assert(buffer_);
+	w.bytes(buffer_->data() + chunks_->base, chunks_->size);
 }
 
 LCF::array2d& LCF::array2d::operator=(array2d const& rhs) {
-	if(this != &rhs) { array2d(rhs).swap(*this); }
+	if(this != &rhs) {
+		buffer_ = rhs.buffer_;
+		chunks_ = rhs.chunks_;
+		table_ = rhs.table_;
+	}
 	return *this;
 }
 
-LCF::array1d::array1d() : base_(0), size_(0), schema_(NULL), index_(0) {}
+LCF::array1d::array1d() : chunks_(empty_chunks()), table_(NULL), index_(0) {}
 LCF::array1d::array1d(array1d const& r)
-		: detail::array1d_base(r), stream_(r.stream_)
-		, base_(r.base_), size_(r.size_)
-		, schema_(r.schema_), index_(r.index_) {}
-
-LCF::array1d::array1d(picojson const& sch, istream_ref const& is)
-		: stream_(is)
-		, base_(is->tellg()), schema_(&sch), index_(0)
-{
-	picojson::array const& list = sch[sym::value].a();
+		: buffer_(r.buffer_), chunks_(r.chunks_)
+		, table_(r.table_), index_(r.index_) {}
 
-	reserve(list.size());
+LCF::array1d::array1d(schema::table const& t, buffer_ref const& buf, cursor& c, int const index)
+		: buffer_(buf), chunks_(index_array1d(t, *buf, c))
+		, table_(&t), index_(index) {}
 
-	uint32_t prev_idx = 0;
-
-	while(not is_eof(*stream_)) {
-		uint32_t const idx = ber(*stream_);
-		if(idx == 0) { break; }
-
-		// check previous index
-		assert(prev_idx <= idx);
-		prev_idx = idx;
-
-		size_t const s = ber(*stream_);
-		insert(value_type(idx, element(find_schema(sch, idx), stream_, s)));
-		stream_->seekg(s, std::istream::cur);
+LCF::array1d& LCF::array1d::operator=(array1d const& rhs) {
+	if(this != &rhs) {
+		buffer_ = rhs.buffer_;
+		chunks_ = rhs.chunks_;
+		table_ = rhs.table_;
+		index_ = rhs.index_;
 	}
-	size_ = size_t(is->tellg()) - base_;
+	return *this;
 }
 
-LCF::array1d& LCF::array1d::operator=(array1d const& rhs) {
-	if(this != &rhs) { array1d(rhs).swap(*this); }
-	return *this;
+LCF::array1d::const_iterator LCF::array1d::begin() const { return chunks_->chunks.begin(); }
+LCF::array1d::const_iterator LCF::array1d::end() const { return chunks_->chunks.end(); }
+size_t LCF::array1d::size() const { return chunks_->chunks.size(); }
+
+LCF::element LCF::array1d::at(const_iterator const i) const {
+	return element(*i->field, buffer_, i->base, i->size);
 }
 
 boost::optional<LCF::element> LCF::array1d::get(picojson::string const& k) const {
-	picojson const& sch = find_schema(*schema_, picojson::string(k));
-	if(sch.is<picojson::null>()) { return boost::none; }
-	else { return (*this).get(sch[sym::index].i()); }
+	return (*this).get(k.get().data(), k.get().size());
 }
 boost::optional<LCF::element> LCF::array1d::get(char const* k) const {
-	return (*this).get(picojson::string(k));
+	return (*this).get(k, std::strlen(k));
+}
+boost::optional<LCF::element> LCF::array1d::get(char const* const k, size_t const len) const {
+	schema::field const* const f = schema::find(*table_, k, len);
+	if(not f) { return boost::none; }
+	else { return (*this).get(f->index); }
 }
 boost::optional<LCF::element> LCF::array1d::get(uint32_t const k) const {
-	const_iterator const i = find(k);
-	if(i != end()) { return i->second; }
+	const_iterator const i = std::lower_bound(begin(), end(), k, chunk_key_less);
+	if(i != end() and i->key == k) { return at(i); }
 
-	picojson const& sch = find_schema(*schema_, k);
-	if(not sch.is<picojson::null>() and has_default(sch))
-	{ return element(sch, istream_ref(), 0); }
+	schema::field const* const f = schema::find(*table_, k);
+	if(f and f->has_default) { return element(*f, buffer_ref(), 0, 0); }
 	else { return boost::none; }
 }
 
 LCF::element LCF::array1d::operator[](picojson::string const& k) const {
-	return (*this)[find_schema(*schema_, picojson::string(k))[sym::index].i()];
+	boost::optional<element> const ret = get(k);
+	assert(ret);
+	return *ret;
 }
 LCF::element LCF::array1d::operator[](char const* k) const {
-	return (*this)[picojson::string(k)];
+	boost::optional<element> const ret = get(k);
+	assert(ret);
+	return *ret;
 }
 LCF::element LCF::array1d::operator[](uint32_t const k) const {
-	const_iterator const i = find(k);
-	if(i != end()) { return i->second; }
-	else {
-		picojson const& sch = find_schema(*schema_, k);
-		assert(has_default(sch));
-		return element(sch, istream_ref(), 0);
-	}
+	boost::optional<element> const ret = get(k);
+	assert(ret);
+	return *ret;
+}
+
+void LCF::array1d::write(writer& w) const {
+	assert(buffer_);
+	w.bytes(buffer_->data() + chunks_->base, chunks_->size);
 }
 
 int LCF::array1d::index() const {
@@ -237,84 +365,98 @@ bool LCF::array1d::is_a2d() const {
 	return (index_ != 0);
 }
 bool LCF::array1d::is_valid() const {
-	return schema_;
+	return table_;
 }
 
-LCF::map_tree::map_tree(std::istream& is) : vector<int32_t>(ber(is)) {
-	for(vector<int32_t>::iterator i = begin(); i != end(); ++i) { *i = ber(is); }
-	active_node = ber(is);
+LCF::map_tree::map_tree(cursor& c) {
+	size_t const s = c.ber();
+	// every node takes a byte at least
+	if(s > c.remaining()) { c.skip(s); }
+	else { resize(s); }
+	for(vector<int32_t>::iterator i = begin(); i != end(); ++i) { *i = c.ber(); }
+	active_node = c.ber();
 }
 
-LCF::ber_array::ber_array(std::istream& is, size_t const len) {
-	size_t const base = is.tellg();
-	while(size_t(is.tellg()) < (base + len)) { push_back(ber(is)); }
+LCF::ber_array::ber_array(cursor& c, size_t const len) {
+	size_t const base = c.tell();
+	while(c.tell() < (base + len) and c.good()) { push_back(c.ber()); }
 }
 
-LCF::element::element(picojson const& sch, istream_ref const& is, size_t const s)
-		: schema_(&sch), stream_(is), base_(is? size_t(is->tellg()) : 0), size_(s) {}
+LCF::element::element(schema::field const& f, buffer_ref const& buf, size_t const base, size_t const s)
+		: field_(&f), buffer_(buf), base_(base), size_(s) {}
 
 namespace LCF {
 
 template<>
-map_tree element::to_impl<map_tree>() const {
-	return map_tree(*stream_);
+map_tree element::to_impl<map_tree>(cursor& c) const {
+	return map_tree(c);
 }
 
 template<>
-ber_array element::to_impl<ber_array>() const {
-	return ber_array(*stream_, size_);
+ber_array element::to_impl<ber_array>(cursor& c) const {
+	return ber_array(c, size_);
 }
 
 template<>
-array1d element::to_impl<array1d>() const {
-	return array1d(actual_schema(*schema_, sym::array1d), stream_);
+array1d element::to_impl<array1d>(cursor& c) const {
+	check_type(schema::array1d);
+	return array1d(*field_->value, buffer_, c);
 }
 template<>
-array2d element::to_impl<array2d>() const {
-	return array2d(actual_schema(*schema_, sym::array2d), stream_);
+array2d element::to_impl<array2d>(cursor& c) const {
+	check_type(schema::array2d);
+	return array2d(*field_->value, buffer_, c);
 }
 
 template<>
-int8_array element::to_impl<int8_array>() const {
-	return int8_array(stream_, size_);
+int8_array element::to_impl<int8_array>(cursor& c) const {
+	if(not exists()) { return int8_array(); }
+	c.skip(size_);
+	return int8_array(buffer_, base_, size_);
 }
 template<>
-int16_array element::to_impl<int16_array>() const {
-	return int16_array(stream_, size_);
+int16_array element::to_impl<int16_array>(cursor& c) const {
+	if(not exists()) { return int16_array(); }
+	c.skip(size_);
+	return int16_array(buffer_, base_, size_);
 }
 template<>
-int32_array element::to_impl<int32_array>() const {
-	return int32_array(stream_, size_);
+int32_array element::to_impl<int32_array>(cursor& c) const {
+	if(not exists()) { return int32_array(); }
+	c.skip(size_);
+	return int32_array(buffer_, base_, size_);
 }
 
 template<>
-int element::to_impl<int>() const {
-	check_type(sym::integer);
-	return exists()? int32_t(ber(*stream_))
-			: (*schema_)[sym::value].i();
+int element::to_impl<int>(cursor& c) const {
+	check_type(schema::integer);
+	return exists()? int32_t(c.ber()) : field_->int_value;
 }
 
 template<>
-bool element::to_impl<bool>() const {
-	check_type(sym::bool_);
-	return exists()? bool(ber(*stream_))
-			: (*schema_)[sym::value].b();
+bool element::to_impl<bool>(cursor& c) const {
+	check_type(schema::bool_);
+	return exists()? bool(c.ber()) : bool(field_->int_value);
 }
 
 template<>
-std::string element::to_impl<std::string>() const {
-	check_type(sym::string);
-	return exists()? read_string(*stream_, size_)
-			: schema_->get(sym::value).s();
+std::string element::to_impl<std::string>(cursor& c) const {
+	check_type(schema::string);
+	return exists()? c.string(size_) : std::string(field_->string_value);
 }
 
 template<>
-double element::to_impl<double>() const {
-	check_type(sym::float_);
-	if(!exists()) { return schema_->get(sym::value).d(); }
+double element::to_impl<double>(cursor& c) const {
+	check_type(schema::float_);
+	if(!exists()) { return field_->float_value; }
+	if(c.remaining() < sizeof(double)) {
+		c.skip(sizeof(double));
+		return field_->float_value;
+	}
 
 	char data[sizeof(double)];
-	stream_->read(data, sizeof(double));
+	std::memcpy(data, c.ptr(), sizeof(double));
+	c.skip(sizeof(double));
 #ifdef BOOST_LITTLE_ENDIAN
 	// don't do anything
 #elif defined BOOST_BIG_ENDIAN
@@ -326,36 +468,26 @@ double element::to_impl<double>() const {
 #else
 #error unknown endianess
 #endif
-	return *reinterpret_cast<double*>(data);
+	double ret;
+	std::memcpy(&ret, data, sizeof(double));
+	return ret;
 }
 
 template<>
-event element::to_impl<event>() const {
-	check_type(sym::event);
-
-	event ret;
-	while(size_t(stream_->tellg()) < (base_ + size_)) {
-		ret.resize(ret.size() + 1);
-		ret.back().code = ber(*stream_);
-		ret.back().nest = ber(*stream_);
-		ret.back().str = read_string(*stream_);
-
-		size_t const len = ber(*stream_);
-		ret.back().args.reserve(len);
-		for(size_t i = 0; i < len; ++i) {
-			ret.back().args.push_back(ber(*stream_));
-		}
-	}
-	return ret;
+event element::to_impl<event>(cursor& c) const {
+	check_type(schema::event);
+	if(not exists()) { return event(); }
+	return event(buffer_, c, base_ + size_);
 }
 
 }
 
 template<class T>
 T LCF::element::to() const {
-	if(stream_) { stream_->seekg(base_); }
-	T const ret = to_impl<T>();
-	if(stream_) { assert(stream_->tellg() == int(base_ + size_)); }
+	// default elements have no buffer and read from the schema
+	cursor c = buffer_? cursor(*buffer_, base_) : cursor();
+	T const ret = to_impl<T>(c);
+	if(buffer_) { assert(c.tell() == base_ + size_); }
 	return ret;
 }
 
@@ -378,54 +510,53 @@ LCF::array1d LCF::element::operator[](uint32_t const k) const { return a2d()[k];
 LCF::element LCF::element::operator[](picojson::string const& k) const { return a1d()[k]; }
 LCF::element LCF::element::operator[](char const* k) const { return a1d()[picojson::string(k)]; }
 
-boost::optional<LCF::array1d const&> LCF::element::get(uint32_t const k) const
+boost::optional<LCF::array1d> LCF::element::get(uint32_t const k) const
 { return a2d().get(k); }
 boost::optional<LCF::element> LCF::element::get(picojson::string const& k) const
 { return a1d().get(k); }
 boost::optional<LCF::element> LCF::element::get(char const* k) const
 { return a1d().get(picojson::string(k)); }
 
-void LCF::element::check_type(picojson::string const& name) const {
-	assert(schema_->get(sym::type).s() == name);
+void LCF::element::check_type(schema::type_t const t) const {
+	assert(field_->type == t);
+	(void)t;
 }
 
-picojson::string const& LCF::element::type() const {
-	return schema_->get(sym::type).s();
+LCF::schema::type_t LCF::element::type() const {
+	return field_->type;
 }
-picojson const& LCF::element::schema() const {
-	assert(schema_);
-	return *schema_;
+LCF::schema::field const& LCF::element::field() const {
+	assert(field_);
+	return *field_;
 }
 
 void LCF::element::write(std::ostream& os) const {
-	assert(stream_);
-	stream_->seekg(base_);
-	vector<char> tmp(size_);
-	BOOST_VERIFY(stream_->readsome(tmp.data(), size_) == int(size_));
-	os.write(tmp.data(), tmp.size());
+	assert(buffer_);
+	assert(base_ + size_ <= buffer_->size());
+	os.write(reinterpret_cast<char const*>(buffer_->data() + base_), size_);
 }
 
 LCF::lcf_file::lcf_file() : schema_(NULL) {}
-LCF::lcf_file::lcf_file(std::string const& file) {
-	std::ifstream ifs(file.c_str(), read_flag);
-	assert(ifs);
-
-	ifs.seekg(0, std::ios::end);
-	vector<char> tmp(ifs.tellg());
-	ifs.seekg(0, std::ios::beg);
-	ifs.read(tmp.data(), tmp.size());
-	stream_ = std::make_shared<std::istringstream>(
-		std::string(tmp.data(), tmp.size()), read_flag);
-
+LCF::lcf_file::lcf_file(std::string const& file)
+		: schema_(NULL), buffer_(buffer::map(file))
+{
+	if(not buffer_) {
+		error_ = "cannot open: " + file;
+		return;
+	}
+	init();
+}
+LCF::lcf_file::lcf_file(istream_ref const& is)
+		: schema_(NULL), buffer_(buffer::read(*is)) {
 	init();
 }
-LCF::lcf_file::lcf_file(istream_ref const& is) : stream_(is) {
+LCF::lcf_file::lcf_file(buffer_ref const& buf) : schema_(NULL), buffer_(buf) {
 	init();
 }
 LCF::lcf_file::lcf_file(BOOST_RV_REF(lcf_file) rhs) : schema_(NULL) {
 	using std::swap;
 	swap(schema_, rhs.schema_);
-	swap(stream_, rhs.stream_);
+	swap(buffer_, rhs.buffer_);
 	swap(signature_, rhs.signature_);
 	swap(error_, rhs.error_);
 	swap(elem_, rhs.elem_);
@@ -434,39 +565,59 @@ LCF::lcf_file::lcf_file(BOOST_RV_REF(lcf_file) rhs) : schema_(NULL) {
 void LCF::lcf_file::swap(lcf_file& x) {
 	using std::swap;
 	swap(schema_, x.schema_);
-	swap(stream_, x.stream_);
+	swap(buffer_, x.buffer_);
 	swap(signature_, x.signature_);
 	swap(error_, x.error_);
 	swap(elem_, x.elem_);
 }
 
 void LCF::lcf_file::init() {
-	signature_ = read_string(*stream_);
-	schema_ = &get_schema(signature_);
-
-	picojson::array const& root = (*schema_)[sym::root].a();
-	elem_.reserve(root.size());
-	for(size_t i = 0; i < root.size(); ++i) {
-		size_t const pos = stream_->tellg();
-
-		picojson::string const& type = root[i][sym::type].s();
-		if(type == sym::array1d) { (void)array1d(root[i], stream_); }
-		else if(type == sym::array2d) { (void)array2d(root[i], stream_); }
-		else if(type == sym::map_tree) { (void)map_tree(*stream_); }
-		else { assert(false); }
-
-		size_t const size = size_t(stream_->tellg()) - pos;
-		stream_->seekg(pos);
-		elem_.push_back(element(root[i], stream_, size));
-		stream_->seekg(size, std::istream::cur);
+	cursor c(*buffer_, 0);
+	/*
+	 * signatures are ascii, compare the raw bytes without decoding.
+	 * files may be opened on preloader threads, which must not touch the codepage state.
+	 */
+	size_t const sig_size = c.ber();
+	if(sig_size > c.remaining()) {
+		error_ = "corrupted signature";
+		return;
+	}
+	std::string const sig(reinterpret_cast<char const*>(c.ptr()), sig_size);
+	c.skip(sig_size);
+	signature_ = sig;
+	schema_ = schema::find_file(sig.data(), sig.size());
+	if(not schema_) {
+		error_ = "unknown signature: " + sig;
+		return;
+	}
+
+	elem_.reserve(schema_->root_count);
+	for(size_t i = 0; i < schema_->root_count; ++i) {
+		schema::field const& f = schema_->root[i];
+		size_t const pos = c.tell();
+
+		switch(f.type) {
+			case schema::array1d: (void)array1d(*f.value, buffer_, c); break;
+			case schema::array2d: (void)array2d(*f.value, buffer_, c); break;
+			case schema::map_tree: (void)map_tree(c); break;
+			default: assert(false); break;
+		}
+
+		elem_.push_back(element(f, buffer_, pos, c.tell() - pos));
+	}
+	if(not c.good()) {
+		error_ = "corrupted file: " + sig;
+		schema_ = NULL;
+		elem_.clear();
+		return;
 	}
-	assert(is_eof(*stream_));
+	assert(c.eof());
 
 	// assert(LCF::to_json(*this).is<picojson::object>());
 }
 
 bool LCF::lcf_file::valid() const {
-	return(schema_ != NULL && stream_);
+	return(schema_ != NULL && buffer_);
 }
 
 LCF::lcf_file::~lcf_file() {}
@@ -481,7 +632,7 @@ boost::optional<LCF::element> LCF::lcf_file::get(picojson::string const& n) cons
 boost::optional<LCF::element> LCF::lcf_file::get(char const* n) const {
 	return root(0).get(picojson::string(n));
 }
-boost::optional<LCF::array1d const&> LCF::lcf_file::get(uint32_t const idx) const {
+boost::optional<LCF::array1d> LCF::lcf_file::get(uint32_t const idx) const {
 	return root(0).get(idx);
 }
 
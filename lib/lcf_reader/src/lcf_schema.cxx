@@ -0,0 +1,38 @@
+#include "lcf_schema.hxx"
+
+#include <cassert>
+#include <cstring>
+
+namespace LCF {
+namespace schema {
+	field const unknown_field = { 0, "", unknown, NULL, false, 0, 0.0, NULL };
+}
+}
+
+LCF::schema::field const* LCF::schema::find(table const& t, char const* const name, size_t const len) {
+	uint32_t const seed = t.name_seeds[hash(name, len, 0) & t.name_seed_mask];
+	int const pos = t.name_slots[hash(name, len, seed) & t.name_mask];
+	if(pos < 0) { return NULL; }
+
+	field const& ret = t.fields[pos];
+	return (std::strncmp(ret.name, name, len) == 0 and ret.name[len] == '\0')? &ret : NULL;
+}
+
+LCF::schema::file const* LCF::schema::find_file(char const* const signature, size_t const len) {
+	for(size_t i = 0; i < file_count; ++i) {
+		if(std::strncmp(files[i].signature, signature, len) == 0 and
+		   files[i].signature[len] == '\0') { return &files[i]; }
+	}
+	return NULL;
+}
+
+char const* LCF::schema::type_name(type_t const t) {
+	static char const* const names[] = {
+		"unknown",
+		"integer", "bool", "float", "string", "event", "map_tree",
+		"int8array", "int16array", "int32array", "ber_array",
+		"array1d", "array2d",
+	};
+	assert(size_t(t) < sizeof(names) / sizeof(names[0]));
+	return names[t];
+}
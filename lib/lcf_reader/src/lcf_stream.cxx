@@ -1,3 +1,4 @@
+#include <cerrno>
 #include <iconv.h>
 #include <istream>
 #include <memory>
@@ -31,6 +32,20 @@ uint32_t LCF::ber(std::istream& is) {
 	return ret;
 }
 
+uint32_t LCF::ber(uint8_t const*& p, uint8_t const* const end) {
+	uint32_t ret = 0;
+	uint8_t cur = 0;
+
+	do {
+		assert(p < end);
+		if(p >= end) { break; }
+		cur = *p++;
+		ret = (ret << 7) | (cur & 0x7fU);
+	} while((cur & 0x80U) != 0);
+
+	return ret;
+}
+
 static size_t const BER_MAX = sizeof(uint32_t)*8 / 7 + 1;
 
 size_t LCF::ber_size(uint32_t v) {
@@ -95,25 +110,165 @@ iconv_wrap::~iconv_wrap() {
 	BOOST_VERIFY(iconv_close(handle_) == 0);
 }
 
+/*
+ * decoding table of a single or double byte codepage.
+ * the table is filled by iconv once, so decoding needs neither iconv
+ * nor its scratch buffer and ASCII runs are copied as is.
+ */
+struct table_decoder : boost::noncopyable {
+	// false if codepage isn't a single or double byte one
+	bool build(char const* codepage);
+	// false if data has a sequence missing in the table
+	bool operator()(uint8_t const* data, size_t s, std::string& ret) const;
+
+  private:
+	enum { invalid = 0xffff };
+
+	uint16_t single_[0x100];
+	// lead byte -> block in double_ + 1, 0 for single bytes
+	uint16_t lead_[0x100];
+	boost::container::vector<uint16_t> double_;
+	// 0x00 - 0x7f are ASCII
+	bool ascii_;
+}; // struct table_decoder
+
+// the source argument of iconv is const on some platforms
+template<class F>
+size_t call_iconv(F func, iconv_t const h, char const** src, size_t* src_left, char** dst, size_t* dst_left) {
+	typedef typename boost::function_traits<
+		typename boost::remove_pointer<F>::type>::arg2_type src_type;
+	return func(h, (src_type)src, src_left, dst, dst_left);
+}
+
+// 1: decoded to one code point, 0: incomplete sequence, -1: invalid
+int decode_one(iconv_t const h, char const* src, size_t src_left, uint32_t& ret) {
+	uint8_t dst_buf[8];
+	char* dst = reinterpret_cast<char*>(dst_buf);
+	size_t dst_left = sizeof(dst_buf);
+
+	::iconv(h, NULL, NULL, NULL, NULL);
+	if(call_iconv(::iconv, h, &src, &src_left, &dst, &dst_left) == (size_t)-1) {
+		return (errno == EINVAL)? 0 : -1;
+	}
+	if(src_left != 0 or dst_left != sizeof(dst_buf) - 4) { return -1; }
+
+	ret = dst_buf[0] | (dst_buf[1] << 8) | (dst_buf[2] << 16) | (uint32_t(dst_buf[3]) << 24);
+	return 1;
+}
+
+bool table_decoder::build(char const* const codepage) {
+	iconv_t const h = iconv_open("UTF-32LE", codepage);
+	if(h == (iconv_t)-1) { return false; }
+
+	bool ret = true;
+	double_.clear();
+	for(size_t b = 0; b < 0x100 and ret; ++b) {
+		char const src[] = { char(b), 0 };
+		uint32_t cp;
+
+		single_[b] = invalid;
+		lead_[b] = 0;
+		switch(decode_one(h, src, 1, cp)) {
+			case 1: if(cp < invalid) { single_[b] = cp; } break;
+			case 0: // lead byte
+				lead_[b] = double_.size() / 0x100 + 1;
+				double_.resize(double_.size() + 0x100, invalid);
+				for(size_t t = 0; t < 0x100; ++t) {
+					char const pair[] = { char(b), char(t) };
+					int const res = decode_one(h, pair, 2, cp);
+					if(res == 1 and cp < invalid) { double_[double_.size() - 0x100 + t] = cp; }
+					// needs more than 2 bytes
+					else if(res == 0) { ret = false; break; }
+				}
+				break;
+			default: break;
+		}
+	}
+	BOOST_VERIFY(iconv_close(h) == 0);
+
+	ascii_ = true;
+	for(size_t i = 0; i < 0x80; ++i) { ascii_ = ascii_ and single_[i] == i; }
+	return ret;
+}
+
+bool table_decoder::operator()(uint8_t const* p, size_t const s, std::string& ret) const {
+	uint8_t const* const end = p + s;
+	ret.clear();
+	ret.reserve(s);
+
+	while(p < end) {
+		if(ascii_ and *p < 0x80) {
+			uint8_t const* const begin = p;
+			while(p < end and *p < 0x80) { ++p; }
+			ret.append(reinterpret_cast<char const*>(begin), p - begin);
+			continue;
+		}
+
+		uint16_t cp;
+		if(lead_[*p]) {
+			if(p + 1 >= end) { return false; }
+			cp = double_[(lead_[*p] - 1) * 0x100 + p[1]];
+			p += 2;
+		} else { cp = single_[*p++]; }
+		if(cp == invalid) { return false; }
+
+		// to UTF-8
+		if(cp < 0x80) { ret += char(cp); }
+		else if(cp < 0x800) {
+			ret += char(0xc0 | (cp >> 6));
+			ret += char(0x80 | (cp & 0x3f));
+		} else {
+			ret += char(0xe0 | (cp >> 12));
+			ret += char(0x80 | ((cp >> 6) & 0x3f));
+			ret += char(0x80 | (cp & 0x3f));
+		}
+	}
+	return true;
+}
+
 char const LCF_ENCODING[] = "UTF-8";
 
+std::string codepage_name = "CP932";
 std::unique_ptr<::iconv_wrap> convert_to_sys(new iconv_wrap("CP932", LCF_ENCODING));
 std::unique_ptr<::iconv_wrap> convert_to_lcf(new iconv_wrap(LCF_ENCODING, "CP932"));
 
+// built on first use, NULL if the codepage has no table
+std::unique_ptr<table_decoder> decoder;
+bool decoder_built = false;
+
+table_decoder const* get_decoder() {
+	if(not decoder_built) {
+		decoder_built = true;
+		decoder.reset(new table_decoder());
+		if(not decoder->build(codepage_name.c_str())) { decoder.reset(); }
+	}
+	return decoder.get();
+}
+
 }
 
 void LCF::set_codepage(unsigned cp) {
-	std::ostringstream oss("CP");
-	oss << cp;
-	std::string const cp_name = oss.str();
-	convert_to_sys.reset(new iconv_wrap(cp_name.c_str(), LCF_ENCODING));
-	convert_to_lcf.reset(new iconv_wrap(LCF_ENCODING, cp_name.c_str()));
+	std::ostringstream oss;
+	oss << "CP" << cp;
+	codepage_name = oss.str();
+	convert_to_sys.reset(new iconv_wrap(codepage_name.c_str(), LCF_ENCODING));
+	convert_to_lcf.reset(new iconv_wrap(LCF_ENCODING, codepage_name.c_str()));
+	decoder.reset();
+	decoder_built = false;
 }
 
 std::string LCF::read_string(std::istream& is, size_t const s) {
-	vector<char> ret(s);
-	is.read(ret.data(), ret.size());
-	return (*convert_to_lcf)(std::string(ret.begin(), ret.end()));
+	std::string ret(s, '\0');
+	is.read(&ret[0], s);
+	return read_string(reinterpret_cast<uint8_t const*>(ret.data()), s);
+}
+
+std::string LCF::read_string(uint8_t const* const data, size_t const s) {
+	std::string ret;
+	table_decoder const* const d = get_decoder();
+	if(d and (*d)(data, s, ret)) { return ret; }
+	// codepages without a table and broken strings
+	return (*convert_to_lcf)(std::string(reinterpret_cast<char const*>(data), s));
 }
 
 std::string LCF::read_string(std::istream& is) {
@@ -125,16 +280,16 @@ std::string LCF::convert(std::string const& data, char const* to, char const* fr
 }
 
 void LCF::write_string(std::ostream& os, std::string const& str) {
-	std::string const sjis = (*convert_to_sys)(str);
+	std::string const sjis = encode_string(str);
 	ber(os, sjis.size());
 	os.write(sjis.c_str(), sjis.size());
 }
 
 void LCF::write_string_without_size(std::ostream& os, std::string const& str) {
-	std::string const sjis = (*convert_to_sys)(str);
+	std::string const sjis = encode_string(str);
 	os.write(sjis.c_str(), sjis.size());
 }
 
-size_t LCF::writing_string_size(std::string const& str) {
-	return (*convert_to_sys)(str).size();
+std::string LCF::encode_string(std::string const& str) {
+	return (*convert_to_sys)(str);
 }
@@ -0,0 +1,85 @@
+#include "lcf_writer.hxx"
+#include "lcf_stream.hxx"
+
+#include <cassert>
+#include <cstring>
+#include <ostream>
+#include <utility>
+
+#include <boost/detail/endian.hpp>
+
+namespace {
+
+size_t const BER_MAX = sizeof(uint32_t)*8 / 7 + 1;
+
+void encode_ber(char* const dst, size_t const s, uint32_t const v) {
+	dst[s - 1] = v & 0x7fU;
+	for(size_t i = s - 1; i > 0; --i) {
+		dst[i - 1] = ((v >> (7*(s - i))) & 0x7fU) | 0x80U;
+	}
+}
+
+}
+
+void LCF::writer::ber(uint32_t const v) {
+	size_t const s = ber_size(v);
+	char data[BER_MAX];
+	encode_ber(data, s, v);
+	bytes(data, s);
+}
+
+void LCF::writer::bytes(void const* const data, size_t const s) {
+	char const* const p = static_cast<char const*>(data);
+	data_.insert(data_.end(), p, p + s);
+}
+
+void LCF::writer::float_(double const v) {
+	char data[sizeof(double)];
+	std::memcpy(data, &v, sizeof(double));
+#ifdef BOOST_LITTLE_ENDIAN
+	// don't do anything
+#elif defined BOOST_BIG_ENDIAN
+	// swap endianess
+	std::swap(data[0], data[7]);
+	std::swap(data[1], data[6]);
+	std::swap(data[2], data[5]);
+	std::swap(data[3], data[4]);
+#else
+#error unknown endianess
+#endif
+	bytes(data, sizeof(double));
+}
+
+void LCF::writer::string(std::string const& str) {
+	std::string const sys = encode_string(str);
+	ber(sys.size());
+	bytes(sys.data(), sys.size());
+}
+
+void LCF::writer::string_without_size(std::string const& str) {
+	std::string const sys = encode_string(str);
+	bytes(sys.data(), sys.size());
+}
+
+void LCF::writer::begin_chunk(uint32_t const key) {
+	ber(key);
+	// most chunks are smaller than 0x80 bytes, keep one byte for the size
+	data_.push_back(0);
+	chunks_.push_back(data_.size());
+}
+
+void LCF::writer::end_chunk() {
+	assert(not chunks_.empty());
+	size_t const body = chunks_.back();
+	chunks_.pop_back();
+
+	uint32_t const s = data_.size() - body;
+	size_t const len = ber_size(s);
+	if(len > 1) { data_.insert(data_.begin() + body, len - 1, 0); }
+	encode_ber(data_.data() + body - 1, len, s);
+}
+
+void LCF::writer::write(std::ostream& os) const {
+	assert(chunks_.empty());
+	os.write(data_.data(), data_.size());
+}
@@ -1,23 +1,1330 @@
 #include <cstdlib>
-extern char const* LCF_SCHEMA_JSON_STRING[];
-char const* LCF_SCHEMA_JSON_STRING[] = {
-  "{\"type\":\"array2d\",\"name\":\"class\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\"},{\"index\":21,\"type\":\"bool\",\"name\":\"double_hand\",\"value\":false},{\"index\":22,\"type\":\"bool\",\"name\":\"fixed_equipment\",\"value\":false},{\"index\":23,\"type\":\"bool\",\"name\":\"forced_ai_action\"},{\"index\":24,\"type\":\"bool\",\"name\":\"strong_defence\"},{\"index\":31,\"type\":\"int16array\",\"name\":\"parameter\"},{\"index\":41,\"type\":\"integer\",\"name\":\"exp_base\"},{\"index\":42,\"type\":\"integer\",\"name\":\"exp_inflation\"},{\"index\":43,\"type\":\"integer\",\"name\":\"exp_correction\",\"value\":0},{\"index\":51,\"type\":\"int16array\",\"name\":\"equipment\"},{\"index\":56,\"type\":\"integer\",\"name\":\"unarmed_attack\",\"value\":1},{\"index\":62,\"type\":\"integer\",\"name\":\"attack_anime\",\"value\":0},{\"index\":63,\"type\":\"array2d\",\"name\":\"skill\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"level\"},{\"index\":2,\"type\":\"integer\",\"name\":\"skill_id\",\"value\":1}]},{\"index\":66,\"type\":\"bool\",\"name\":\"use_original_command\",\"value\":false},{\"index\":67,\"type\":\"string\",\"name\":\"original_command\"},{\"index\":71,\"type\":\"integer\",\"name\":\"condition_data_num\",\"value\":0},{\"index\":72,\"type\":\"int8array\",\"name\":\"condition_data\"},{\"index\":73,\"type\":\"integer\",\"name\":\"attrib_data_num\",\"value\":0},{\"index\":74,\"type\":\"int8array\",\"name\":\"attrib_data\"},{\"index\":80,\"type\":\"int32array\",\"name\":\"battle_command\"}]}",
+#include "lcf_schema.hxx"
 
-  "{\"type\":\"array2d\",\"name\":\"common_event\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":11,\"type\":\"integer\",\"name\":\"start_type\",\"value\":5},{\"index\":12,\"type\":\"bool\",\"name\":\"need_switch\",\"value\":false},{\"index\":13,\"type\":\"integer\",\"name\":\"switch_id\",\"value\":1},{\"index\":21,\"type\":\"integer\",\"name\":\"event_length\"},{\"index\":22,\"type\":\"event\",\"name\":\"event\"}]}",
+namespace {
 
-  "{\"type\":\"array1d\",\"name\":\"event_state\",\"value\":[{\"index\":11,\"type\":\"integer\",\"name\":\"map_id\"},{\"index\":12,\"type\":\"integer\",\"name\":\"x\",\"value\":0},{\"index\":13,\"type\":\"integer\",\"name\":\"y\",\"value\":0},{\"index\":21,\"type\":\"integer\",\"name\":\"def_dir\"},{\"index\":22,\"type\":\"integer\",\"name\":\"talk_dir\"},{\"index\":23,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":24,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":31,\"type\":\"integer\",\"name\":\"action\",\"value\":0},{\"index\":32,\"type\":\"integer\",\"name\":\"freq\"},{\"index\":33,\"type\":\"integer\",\"name\":\"start_type\",\"value\":0},{\"index\":34,\"type\":\"integer\",\"name\":\"priority_type\"},{\"index\":35,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":36,\"type\":\"integer\",\"name\":\"anime_type\",\"value\":0},{\"index\":37,\"type\":\"integer\",\"name\":\"speed\",\"value\":3},{\"index\":41,\"type\":\"array1d\",\"name\":\"move\",\"value\":[{\"index\":11,\"type\":\"integer\",\"name\":\"length\",\"value\":0},{\"index\":12,\"type\":\"ber_array\",\"name\":\"data\"},{\"index\":21,\"type\":\"bool\",\"name\":\"repeat\",\"value\":true},{\"index\":22,\"type\":\"bool\",\"name\":\"pass\",\"value\":false}]},{\"index\":43,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":46,\"type\":\"bool\",\"name\":\"is_trans\",\"value\":false},{\"index\":52,\"type\":\"integer\",\"name\":\"counter\",\"value\":0},{\"index\":53,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":54,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":71,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":72,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":73,\"type\":\"string\",\"name\":\"char_set\"},{\"index\":74,\"type\":\"integer\",\"name\":\"char_set_pos\",\"value\":0},{\"index\":75,\"type\":\"integer\",\"name\":\"char_set_pat\",\"value\":1},{\"index\":81,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":82,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":83,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":101,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":103,\"type\":\"integer\",\"name\":\"vehicle\",\"value\":0},{\"index\":108,\"type\":\"array1d\",\"name\":\"dummy\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"dummy\"}]},{\"index\":121,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":131,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":132,\"type\":\"int8array\",\"name\":\"dummy\"}]}",
+using LCF::schema::field;
+using LCF::schema::table;
 
-  "{\"signature\":\"LcfDataBase\",\"root\":[{\"type\":\"array1d\",\"name\":\"global\",\"value\":[{\"index\":11,\"type\":\"array2d\",\"name\":\"actor\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"title\"},{\"index\":3,\"type\":\"string\",\"name\":\"charset\"},{\"index\":4,\"type\":\"integer\",\"name\":\"charset_index\",\"value\":0},{\"index\":5,\"type\":\"bool\",\"name\":\"semi_trans\",\"value\":false},{\"index\":7,\"type\":\"integer\",\"name\":\"start_level\",\"value\":1},{\"index\":8,\"type\":\"integer\",\"name\":\"final_level\"},{\"index\":9,\"type\":\"bool\",\"name\":\"critical\",\"value\":true},{\"index\":10,\"type\":\"integer\",\"name\":\"critical_rate\",\"value\":30},{\"index\":15,\"type\":\"string\",\"name\":\"faceset\"},{\"index\":16,\"type\":\"integer\",\"name\":\"faceset_index\",\"value\":0},{\"index\":21,\"type\":\"bool\",\"name\":\"double_hand\",\"value\":false},{\"index\":22,\"type\":\"bool\",\"name\":\"equip_fix\",\"value\":false},{\"index\":23,\"type\":\"bool\",\"name\":\"ai_action\",\"value\":false},{\"index\":24,\"type\":\"bool\",\"name\":\"strong_defence\",\"value\":false},{\"index\":31,\"type\":\"int16array\",\"name\":\"parameter\"},{\"index\":41,\"type\":\"integer\",\"name\":\"exp_base\"},{\"index\":42,\"type\":\"integer\",\"name\":\"exp_inflation\"},{\"index\":43,\"type\":\"integer\",\"name\":\"exp_correction\",\"value\":0},{\"index\":51,\"type\":\"int16array\",\"name\":\"equipment\"},{\"index\":56,\"type\":\"integer\",\"name\":\"unarmed_attack\",\"value\":1},{\"index\":57,\"type\":\"integer\",\"name\":\"job\",\"value\":0},{\"index\":58,\"type\":\"integer\",\"name\":\"battle_anime\",\"value\":0},{\"index\":60,\"type\":\"integer\",\"name\":\"battle_x\",\"value\":0},{\"index\":61,\"type\":\"integer\",\"name\":\"battle_y\",\"value\":0},{\"index\":62,\"type\":\"integer\",\"name\":\"attack_anime\",\"value\":0},{\"index\":63,\"type\":\"array2d\",\"name\":\"skill\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"level\",\"value\":1},{\"index\":2,\"type\":\"integer\",\"name\":\"skill_id\",\"value\":1}]},{\"index\":66,\"type\":\"bool\",\"name\":\"use_original_command\",\"value\":false},{\"index\":67,\"type\":\"string\",\"name\":\"original_command\"},{\"index\":71,\"type\":\"integer\",\"name\":\"condition_data_num\",\"value\":0},{\"index\":72,\"type\":\"int8array\",\"name\":\"condition_data\"},{\"index\":73,\"type\":\"integer\",\"name\":\"attrib_data_num\",\"value\":0},{\"index\":74,\"type\":\"int8array\",\"name\":\"attrib_data\"},{\"index\":80,\"type\":\"int32array\",\"name\":\"battle_command\"}]},{\"index\":12,\"type\":\"array2d\",\"name\":\"skill\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"comment\"},{\"index\":3,\"type\":\"string\",\"name\":\"message_l1\"},{\"index\":4,\"type\":\"string\",\"name\":\"message_l2\"},{\"index\":7,\"type\":\"integer\",\"name\":\"message_failed\"},{\"index\":8,\"type\":\"integer\",\"name\":\"type\",\"value\":0},{\"index\":11,\"type\":\"integer\",\"name\":\"using_mp_amount\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"range\",\"value\":0},{\"index\":13,\"type\":\"integer\",\"name\":\"switch_id\",\"value\":1},{\"index\":14,\"type\":\"integer\",\"name\":\"anime_id\",\"value\":1},{\"index\":16,\"type\":\"sound\",\"name\":\"sound\"},{\"index\":18,\"type\":\"bool\",\"name\":\"use_at_field\",\"value\":true},{\"index\":19,\"type\":\"bool\",\"name\":\"use_at_battle\",\"value\":false},{\"index\":20,\"type\":\"bool\",\"name\":\"condition_effect\",\"value\":false},{\"index\":21,\"type\":\"integer\",\"name\":\"blow_relation\",\"value\":0},{\"index\":22,\"type\":\"integer\",\"name\":\"mental_relation\",\"value\":3},{\"index\":23,\"type\":\"integer\",\"name\":\"effect_variance\",\"value\":4},{\"index\":24,\"type\":\"integer\",\"name\":\"basic_effect\",\"value\":0},{\"index\":25,\"type\":\"integer\",\"name\":\"succeed_rate\",\"value\":100},{\"index\":31,\"type\":\"bool\",\"name\":\"affect_hp\",\"value\":false},{\"index\":32,\"type\":\"bool\",\"name\":\"affect_mp\",\"value\":false},{\"index\":33,\"type\":\"bool\",\"name\":\"affect_attack\",\"value\":false},{\"index\":34,\"type\":\"bool\",\"name\":\"affect_defence\",\"value\":false},{\"index\":35,\"type\":\"bool\",\"name\":\"affect_mental\",\"value\":false},{\"index\":36,\"type\":\"bool\",\"name\":\"affect_speed\",\"value\":false},{\"index\":37,\"type\":\"bool\",\"name\":\"absorption\",\"value\":false},{\"index\":38,\"type\":\"bool\",\"name\":\"ignore_defence\",\"value\":false},{\"index\":41,\"type\":\"integer\",\"name\":\"condition_data_num\",\"value\":0},{\"index\":42,\"type\":\"int8array\",\"name\":\"condition_data\"},{\"index\":43,\"type\":\"integer\",\"name\":\"attrib_data_num\",\"value\":0},{\"index\":44,\"type\":\"int8array\",\"name\":\"attrib_data\"},{\"index\":45,\"type\":\"bool\",\"name\":\"change_attrib\"}]},{\"index\":13,\"type\":\"array2d\",\"name\":\"item\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"comment\"},{\"index\":3,\"type\":\"integer\",\"name\":\"type\",\"value\":0},{\"index\":5,\"type\":\"integer\",\"name\":\"price\",\"value\":0},{\"index\":6,\"type\":\"integer\",\"name\":\"usable_time\",\"value\":1},{\"index\":11,\"type\":\"integer\",\"name\":\"attack\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"defence\",\"value\":0},{\"index\":13,\"type\":\"integer\",\"name\":\"mind\",\"value\":0},{\"index\":14,\"type\":\"integer\",\"name\":\"speed\",\"value\":0},{\"index\":15,\"type\":\"integer\",\"name\":\"hand\",\"value\":0},{\"index\":16,\"type\":\"integer\",\"name\":\"using_mp\",\"value\":0},{\"index\":17,\"type\":\"integer\",\"name\":\"hit_rate\",\"value\":0},{\"index\":18,\"type\":\"integer\",\"name\":\"critical_rate\",\"value\":0},{\"index\":20,\"type\":\"integer\",\"name\":\"anime_id\",\"value\":1},{\"index\":21,\"type\":\"bool\",\"name\":\"first_strike\",\"value\":false},{\"index\":22,\"type\":\"bool\",\"name\":\"double_attack\",\"value\":false},{\"index\":23,\"type\":\"bool\",\"name\":\"attack_all\",\"value\":false},{\"index\":24,\"type\":\"bool\",\"name\":\"ignore_evasion_rate\",\"value\":false},{\"index\":25,\"type\":\"bool\",\"name\":\"prevent_critical\",\"value\":false},{\"index\":26,\"type\":\"bool\",\"name\":\"increase_evasion_rate\",\"value\":false},{\"index\":27,\"type\":\"bool\",\"name\":\"half_using_mp_\",\"value\":false},{\"index\":28,\"type\":\"bool\",\"name\":\"ignore_terrain_damage\",\"value\":false},{\"index\":29,\"type\":\"bool\",\"name\":\"fix_equipment\",\"value\":false},{\"index\":31,\"type\":\"integer\",\"name\":\"effect_range\",\"value\":0},{\"index\":32,\"type\":\"integer\",\"name\":\"hp_amount\",\"value\":0},{\"index\":33,\"type\":\"integer\",\"name\":\"hp_rate\",\"value\":0},{\"index\":34,\"type\":\"integer\",\"name\":\"mp_amount\",\"value\":0},{\"index\":35,\"type\":\"integer\",\"name\":\"mp_rate\",\"value\":0},{\"index\":37,\"type\":\"bool\",\"name\":\"only_at_field\",\"value\":false},{\"index\":38,\"type\":\"bool\",\"name\":\"only_for_knockouts\",\"value\":false},{\"index\":41,\"type\":\"integer\",\"name\":\"increase_hp\",\"value\":0},{\"index\":42,\"type\":\"integer\",\"name\":\"increase_mp\",\"value\":0},{\"index\":43,\"type\":\"integer\",\"name\":\"increase_attack\",\"value\":0},{\"index\":44,\"type\":\"integer\",\"name\":\"increase_defence\",\"value\":0},{\"index\":45,\"type\":\"integer\",\"name\":\"increase_mind\",\"value\":0},{\"index\":46,\"type\":\"integer\",\"name\":\"increase_speed\",\"value\":0},{\"index\":51,\"type\":\"integer\",\"name\":\"message_type\",\"value\":0},{\"index\":53,\"type\":\"integer\",\"name\":\"skill_id\",\"value\":1},{\"index\":55,\"type\":\"integer\",\"name\":\"switch_id\",\"value\":1},{\"index\":57,\"type\":\"bool\",\"name\":\"use_at_field\",\"value\":true},{\"index\":59,\"type\":\"bool\",\"name\":\"use_at_battle\",\"value\":false},{\"index\":61,\"type\":\"integer\",\"name\":\"equip_data_num\",\"value\":0},{\"index\":62,\"type\":\"int8array\",\"name\":\"equip_data\"},{\"index\":63,\"type\":\"integer\",\"name\":\"condition_data_num\",\"value\":0},{\"index\":64,\"type\":\"int8array\",\"name\":\"condition_data\"},{\"index\":65,\"type\":\"integer\",\"name\":\"attrib_data_num\",\"value\":0},{\"index\":66,\"type\":\"int8array\",\"name\":\"attrib_data\"},{\"index\":67,\"type\":\"integer\",\"name\":\"condition_rate\",\"value\":0},{\"index\":68,\"type\":\"bool\",\"name\":\"condition_flip\",\"value\":false},{\"index\":69,\"type\":\"integer\",\"name\":\"use_anime_id\"},{\"index\":71,\"type\":\"bool\",\"name\":\"use_skill_as_item\",\"value\":false},{\"index\":72,\"type\":\"integer\",\"name\":\"job_data_num\",\"value\":0},{\"index\":73,\"type\":\"int8array\",\"name\":\"job_data\"}]},{\"index\":14,\"type\":\"array2d\",\"name\":\"enemy\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"monster\"},{\"index\":3,\"type\":\"integer\",\"name\":\"hue\",\"value\":0},{\"index\":4,\"type\":\"integer\",\"name\":\"hp\",\"value\":10},{\"index\":5,\"type\":\"integer\",\"name\":\"mp\",\"value\":10},{\"index\":6,\"type\":\"integer\",\"name\":\"attack\",\"value\":10},{\"index\":7,\"type\":\"integer\",\"name\":\"defence\",\"value\":10},{\"index\":8,\"type\":\"integer\",\"name\":\"mind\",\"value\":10},{\"index\":9,\"type\":\"integer\",\"name\":\"speed\",\"value\":10},{\"index\":10,\"type\":\"bool\",\"name\":\"semi_trans\",\"value\":false},{\"index\":11,\"type\":\"integer\",\"name\":\"exp\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"money\",\"value\":0},{\"index\":13,\"type\":\"integer\",\"name\":\"dropping_item_id\",\"value\":0},{\"index\":14,\"type\":\"integer\",\"name\":\"item_drop_rate\",\"value\":100},{\"index\":21,\"type\":\"bool\",\"name\":\"critical\",\"value\":false},{\"index\":22,\"type\":\"integer\",\"name\":\"critical_rate\",\"value\":30},{\"index\":26,\"type\":\"bool\",\"name\":\"increase_miss\",\"value\":false},{\"index\":28,\"type\":\"bool\",\"name\":\"in_the_air\",\"value\":false},{\"index\":31,\"type\":\"integer\",\"name\":\"condition_data_num\",\"value\":0},{\"index\":32,\"type\":\"int8array\",\"name\":\"condition_data\"},{\"index\":33,\"type\":\"integer\",\"name\":\"attrib_data_num\",\"value\":0},{\"index\":34,\"type\":\"int8array\",\"name\":\"attrib_data\"},{\"index\":42,\"type\":\"array2d\",\"name\":\"actions\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"action_type\"},{\"index\":2,\"type\":\"integer\",\"name\":\"basic_action\",\"value\":1},{\"index\":3,\"type\":\"integer\",\"name\":\"skill_id\",\"value\":1},{\"index\":4,\"type\":\"integer\",\"name\":\"enemy_id\",\"value\":1},{\"index\":5,\"type\":\"integer\",\"name\":\"action_term\",\"value\":0},{\"index\":6,\"type\":\"integer\",\"name\":\"a\",\"value\":0},{\"index\":7,\"type\":\"integer\",\"name\":\"b\",\"value\":0},{\"index\":8,\"type\":\"integer\",\"name\":\"switch_id\",\"value\":1},{\"index\":9,\"type\":\"bool\",\"name\":\"on_after_action\",\"value\":false},{\"index\":10,\"type\":\"integer\",\"name\":\"on_switch_id\",\"value\":1},{\"index\":11,\"type\":\"bool\",\"name\":\"off_after_action\",\"value\":false},{\"index\":12,\"type\":\"integer\",\"name\":\"off_switch_id\",\"value\":1},{\"index\":13,\"type\":\"integer\",\"name\":\"priority\",\"value\":50}]}]},{\"index\":15,\"type\":\"array2d\",\"name\":\"enemy_group\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"array2d\",\"name\":\"enemy_enum\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"enemy_id\",\"value\":1},{\"index\":2,\"type\":\"integer\",\"name\":\"x\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"y\",\"value\":0},{\"index\":4,\"type\":\"bool\",\"name\":\"invisible\",\"value\":false}]},{\"index\":4,\"type\":\"integer\",\"name\":\"terrain_data_num\"},{\"index\":5,\"type\":\"int8array\",\"name\":\"terrain_data\"},{\"index\":11,\"type\":\"array2d\",\"name\":\"battle_event\",\"value\":[{\"index\":2,\"type\":\"array1d\",\"name\":\"term\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"flags\",\"value\":0},{\"index\":2,\"type\":\"integer\",\"name\":\"switch_id1\",\"value\":1},{\"index\":3,\"type\":\"integer\",\"name\":\"switch_id2\",\"value\":1},{\"index\":4,\"type\":\"integer\",\"name\":\"variable_id\",\"value\":1},{\"index\":5,\"type\":\"integer\",\"name\":\"variable_value\",\"value\":0},{\"index\":6,\"type\":\"integer\",\"name\":\"trun_freq\",\"value\":0},{\"index\":7,\"type\":\"integer\",\"name\":\"turn_offset\",\"value\":0},{\"index\":8,\"type\":\"integer\",\"name\":\"fatigue_min\",\"value\":0},{\"index\":9,\"type\":\"integer\",\"name\":\"fatigue_max\",\"value\":100},{\"index\":10,\"type\":\"integer\",\"name\":\"enemy_id\",\"value\":0},{\"index\":11,\"type\":\"integer\",\"name\":\"enemy_hp_min\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"enemy_hp_max\",\"value\":100},{\"index\":13,\"type\":\"integer\",\"name\":\"proponent_id\",\"value\":1},{\"index\":14,\"type\":\"integer\",\"name\":\"proponent_hp_from\",\"value\":0},{\"index\":15,\"type\":\"integer\",\"name\":\"proponent_hp_to\",\"value\":100},{\"index\":16,\"type\":\"integer\",\"name\":\"turn_freq\",\"value\":0},{\"index\":17,\"type\":\"integer\",\"name\":\"turn_offset\",\"value\":0},{\"index\":18,\"type\":\"integer\",\"name\":\"turn_freq\",\"value\":0},{\"index\":19,\"type\":\"integer\",\"name\":\"turn_offset\",\"value\":0},{\"index\":20,\"type\":\"integer\",\"name\":\"turn_freq\",\"value\":0},{\"index\":21,\"type\":\"integer\",\"name\":\"turn_offset\",\"value\":0},{\"index\":22,\"type\":\"integer\",\"name\":\"trun_freq\",\"value\":0},{\"index\":23,\"type\":\"integer\",\"name\":\"turn_offset\",\"value\":0}]},{\"index\":11,\"type\":\"integer\",\"name\":\"event_length\",\"value\":0},{\"index\":12,\"type\":\"event\",\"name\":\"event\"}]}]},{\"index\":16,\"type\":\"array2d\",\"name\":\"terrain\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"integer\",\"name\":\"damage\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"rate\",\"value\":100},{\"index\":4,\"type\":\"string\",\"name\":\"backdrop\"},{\"index\":5,\"type\":\"bool\",\"name\":\"boat\",\"value\":false},{\"index\":6,\"type\":\"bool\",\"name\":\"ship\",\"value\":false},{\"index\":7,\"type\":\"bool\",\"name\":\"airship\",\"value\":true},{\"index\":9,\"type\":\"bool\",\"name\":\"airship_land\",\"value\":true},{\"index\":11,\"type\":\"integer\",\"name\":\"char_view_type\",\"value\":0},{\"index\":15,\"type\":\"sound\",\"name\":\"footstep\"},{\"index\":16,\"type\":\"bool\",\"name\":\"on_damage_se\"},{\"index\":17,\"type\":\"integer\",\"name\":\"background_type\"},{\"index\":21,\"type\":\"string\",\"name\":\"background_a_name\"},{\"index\":22,\"type\":\"bool\",\"name\":\"background_a_scrollh\"},{\"index\":23,\"type\":\"bool\",\"name\":\"background_a_scrollv\"},{\"index\":24,\"type\":\"integer\",\"name\":\"background_a_scrollh_speed\"},{\"index\":25,\"type\":\"integer\",\"name\":\"background_a_scrollv_speed\"},{\"index\":30,\"type\":\"bool\",\"name\":\"background_b\"},{\"index\":31,\"type\":\"string\",\"name\":\"background_b_name\"},{\"index\":32,\"type\":\"bool\",\"name\":\"background_b_scrollh\"},{\"index\":33,\"type\":\"bool\",\"name\":\"background_b_scrollv\"},{\"index\":34,\"type\":\"integer\",\"name\":\"background_b_scrollh_speed\"},{\"index\":35,\"type\":\"integer\",\"name\":\"background_b_scrollv_speed\"},{\"index\":40,\"type\":\"integer\",\"name\":\"special_flags\"},{\"index\":41,\"type\":\"integer\",\"name\":\"special_back_party\"},{\"index\":42,\"type\":\"integer\",\"name\":\"special_back_enemies\"},{\"index\":43,\"type\":\"integer\",\"name\":\"special_lateral_party\"},{\"index\":44,\"type\":\"integer\",\"name\":\"special_lateral_enemies\"},{\"index\":45,\"type\":\"integer\",\"name\":\"grid_location\"},{\"index\":46,\"type\":\"integer\",\"name\":\"grid_a\"},{\"index\":47,\"type\":\"integer\",\"name\":\"grid_b\"},{\"index\":48,\"type\":\"integer\",\"name\":\"grid_c\"}]},{\"index\":17,\"type\":\"array2d\",\"name\":\"attribute\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"integer\",\"name\":\"type\",\"value\":0},{\"index\":11,\"type\":\"integer\",\"name\":\"rate_a\",\"value\":300},{\"index\":12,\"type\":\"integer\",\"name\":\"rate_b\",\"value\":200},{\"index\":13,\"type\":\"integer\",\"name\":\"rate_c\",\"value\":100},{\"index\":14,\"type\":\"integer\",\"name\":\"rate_d\",\"value\":50},{\"index\":15,\"type\":\"integer\",\"name\":\"rate_e\",\"value\":0}]},{\"index\":18,\"type\":\"array2d\",\"name\":\"condition\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"integer\",\"name\":\"type\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"color\",\"value\":6},{\"index\":4,\"type\":\"integer\",\"name\":\"priority\",\"value\":50},{\"index\":5,\"type\":\"integer\",\"name\":\"restrict\",\"value\":0},{\"index\":11,\"type\":\"integer\",\"name\":\"rate_a\",\"value\":100},{\"index\":12,\"type\":\"integer\",\"name\":\"rate_b\",\"value\":80},{\"index\":13,\"type\":\"integer\",\"name\":\"rate_c\",\"value\":60},{\"index\":14,\"type\":\"integer\",\"name\":\"rate_d\",\"value\":30},{\"index\":15,\"type\":\"integer\",\"name\":\"rate_e\",\"value\":0},{\"index\":21,\"type\":\"integer\",\"name\":\"cure_turn\",\"value\":0},{\"index\":22,\"type\":\"integer\",\"name\":\"cure_rate\",\"value\":0},{\"index\":23,\"type\":\"integer\",\"name\":\"shock_cure_rate\",\"value\":0},{\"index\":31,\"type\":\"bool\",\"name\":\"attack\",\"value\":false},{\"index\":32,\"type\":\"bool\",\"name\":\"defence\",\"value\":false},{\"index\":33,\"type\":\"bool\",\"name\":\"mind\",\"value\":false},{\"index\":34,\"type\":\"bool\",\"name\":\"speed\",\"value\":false},{\"index\":35,\"type\":\"integer\",\"name\":\"hit_rate\",\"value\":100},{\"index\":41,\"type\":\"bool\",\"name\":\"disable_blow_skill\",\"value\":false},{\"index\":42,\"type\":\"integer\",\"name\":\"blow_relation\",\"value\":0},{\"index\":43,\"type\":\"bool\",\"name\":\"disable_mind_skill\",\"value\":false},{\"index\":44,\"type\":\"integer\",\"name\":\"mind_relation\",\"value\":0},{\"index\":51,\"type\":\"string\",\"name\":\"message_member\"},{\"index\":52,\"type\":\"string\",\"name\":\"message_enemy\"},{\"index\":53,\"type\":\"string\",\"name\":\"message_already\"},{\"index\":54,\"type\":\"string\",\"name\":\"message_last\"},{\"index\":55,\"type\":\"string\",\"name\":\"message_cure\"},{\"index\":61,\"type\":\"integer\",\"name\":\"turn_hp_amount\",\"value\":0},{\"index\":62,\"type\":\"integer\",\"name\":\"turn_hp_rate\",\"value\":0},{\"index\":63,\"type\":\"integer\",\"name\":\"field_hp_step\",\"value\":0},{\"index\":64,\"type\":\"integer\",\"name\":\"field_hp_amount\",\"value\":0},{\"index\":65,\"type\":\"integer\",\"name\":\"turn_mp_amount\",\"value\":0},{\"index\":66,\"type\":\"integer\",\"name\":\"turn_mp_rate\",\"value\":0},{\"index\":67,\"type\":\"integer\",\"name\":\"field_mp_step\",\"value\":0},{\"index\":68,\"type\":\"integer\",\"name\":\"field_mp_amount\",\"value\":0}]},{\"index\":19,\"type\":\"array2d\",\"name\":\"animation\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"battle\"},{\"index\":6,\"type\":\"array2d\",\"name\":\"Effect\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"frame_id\",\"value\":0},{\"index\":2,\"type\":\"sound\",\"name\":\"sound\"},{\"index\":3,\"type\":\"integer\",\"name\":\"range\",\"value\":0},{\"index\":4,\"type\":\"integer\",\"name\":\"red\",\"value\":31},{\"index\":5,\"type\":\"integer\",\"name\":\"green\",\"value\":31},{\"index\":6,\"type\":\"integer\",\"name\":\"blue\",\"value\":31},{\"index\":7,\"type\":\"integer\",\"name\":\"flash\",\"value\":31}]},{\"index\":9,\"type\":\"integer\",\"name\":\"range\",\"value\":0},{\"index\":10,\"type\":\"integer\",\"name\":\"y_base\",\"value\":0},{\"index\":11,\"type\":\"integer\",\"name\":\"use_grid\",\"value\":0},{\"index\":12,\"type\":\"array2d\",\"name\":\"frame\",\"value\":[{\"index\":1,\"type\":\"array2d\",\"name\":\"cell\",\"value\":[{\"index\":1,\"type\":\"bool\",\"name\":\"visible\",\"value\":true},{\"index\":2,\"type\":\"integer\",\"name\":\"battle_pos\"},{\"index\":3,\"type\":\"integer\",\"name\":\"x\",\"value\":0},{\"index\":4,\"type\":\"integer\",\"name\":\"y\",\"value\":0},{\"index\":5,\"type\":\"integer\",\"name\":\"zoom\",\"value\":0},{\"index\":6,\"type\":\"integer\",\"name\":\"red\",\"value\":100},{\"index\":7,\"type\":\"integer\",\"name\":\"green\",\"value\":100},{\"index\":8,\"type\":\"integer\",\"name\":\"blue\",\"value\":100},{\"index\":9,\"type\":\"integer\",\"name\":\"chroma\",\"value\":100},{\"index\":10,\"type\":\"integer\",\"name\":\"transparency\",\"value\":0}]}]}]},{\"index\":20,\"type\":\"array2d\",\"name\":\"chipset\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"chipset\"},{\"index\":3,\"type\":\"int16array\",\"name\":\"terrain_id\"},{\"index\":4,\"type\":\"int8array\",\"name\":\"lower\"},{\"index\":5,\"type\":\"int8array\",\"name\":\"upper\"},{\"index\":11,\"type\":\"integer\",\"name\":\"ocean_sequence\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"ocean_speed\",\"value\":0}]},{\"index\":21,\"type\":\"array1d\",\"name\":\"term\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"battle_start\"},{\"index\":2,\"type\":\"string\",\"name\":\"first_strike\"},{\"index\":3,\"type\":\"string\",\"name\":\"escape_success\"},{\"index\":4,\"type\":\"string\",\"name\":\"escape_failure\"},{\"index\":5,\"type\":\"string\",\"name\":\"battle_won\"},{\"index\":6,\"type\":\"string\",\"name\":\"battle_lost\"},{\"index\":7,\"type\":\"string\",\"name\":\"gain_exp\"},{\"index\":8,\"type\":\"string\",\"name\":\"earn_money_begin\"},{\"index\":9,\"type\":\"string\",\"name\":\"earn_money_end\"},{\"index\":10,\"type\":\"string\",\"name\":\"item_get\"},{\"index\":11,\"type\":\"string\",\"name\":\"normal_attack\"},{\"index\":12,\"type\":\"string\",\"name\":\"critical_attack_party\"},{\"index\":13,\"type\":\"string\",\"name\":\"critical_attack_enemy\"},{\"index\":14,\"type\":\"string\",\"name\":\"defended\"},{\"index\":15,\"type\":\"string\",\"name\":\"do_nothing\"},{\"index\":16,\"type\":\"string\",\"name\":\"charge_power\"},{\"index\":17,\"type\":\"string\",\"name\":\"self_destruct\"},{\"index\":18,\"type\":\"string\",\"name\":\"run_away\"},{\"index\":19,\"type\":\"string\",\"name\":\"transform\"},{\"index\":20,\"type\":\"string\",\"name\":\"damage_to_enemy\"},{\"index\":21,\"type\":\"string\",\"name\":\"no_damage_to_enemy\"},{\"index\":22,\"type\":\"string\",\"name\":\"damage_to_party\"},{\"index\":23,\"type\":\"string\",\"name\":\"no_damage_to_party\"},{\"index\":24,\"type\":\"string\",\"name\":\"skill_failure_a\"},{\"index\":25,\"type\":\"string\",\"name\":\"skill_failure_b\"},{\"index\":26,\"type\":\"string\",\"name\":\"skill_failure_c\"},{\"index\":27,\"type\":\"string\",\"name\":\"physical_atrack_failure\"},{\"index\":28,\"type\":\"string\",\"name\":\"item_use\"},{\"index\":29,\"type\":\"string\",\"name\":\"parameter_recovery\"},{\"index\":30,\"type\":\"string\",\"name\":\"parameer_up\"},{\"index\":31,\"type\":\"string\",\"name\":\"parameer_down\"},{\"index\":32,\"type\":\"string\",\"name\":\"party_abusorb_parameter\"},{\"index\":33,\"type\":\"string\",\"name\":\"enemy_abusorb_parameter\"},{\"index\":34,\"type\":\"string\",\"name\":\"attribute_gaurd_up\"},{\"index\":35,\"type\":\"string\",\"name\":\"attribute_gaurd_down\"},{\"index\":36,\"type\":\"string\",\"name\":\"level_up\"},{\"index\":37,\"type\":\"string\",\"name\":\"skill_mastered\"},{\"index\":38,\"type\":\"string\",\"name\":\"miss\"},{\"index\":41,\"type\":\"string\",\"name\":\"select_action\"},{\"index\":42,\"type\":\"string\",\"name\":\"select_action_second\"},{\"index\":43,\"type\":\"string\",\"name\":\"buy\"},{\"index\":44,\"type\":\"string\",\"name\":\"sell\"},{\"index\":45,\"type\":\"string\",\"name\":\"cancel\"},{\"index\":46,\"type\":\"string\",\"name\":\"select_buying_item\"},{\"index\":47,\"type\":\"string\",\"name\":\"buying_item_num\"},{\"index\":48,\"type\":\"string\",\"name\":\"end_buy\"},{\"index\":49,\"type\":\"string\",\"name\":\"select_selling_item\"},{\"index\":50,\"type\":\"string\",\"name\":\"selling_item_num\"},{\"index\":51,\"type\":\"string\",\"name\":\"end_sell\"},{\"index\":54,\"type\":\"string\",\"name\":\"v54\"},{\"index\":55,\"type\":\"string\",\"name\":\"v55\"},{\"index\":56,\"type\":\"string\",\"name\":\"v56\"},{\"index\":57,\"type\":\"string\",\"name\":\"v57\"},{\"index\":58,\"type\":\"string\",\"name\":\"v58\"},{\"index\":59,\"type\":\"string\",\"name\":\"v59\"},{\"index\":60,\"type\":\"string\",\"name\":\"v60\"},{\"index\":61,\"type\":\"string\",\"name\":\"v61\"},{\"index\":62,\"type\":\"string\",\"name\":\"v62\"},{\"index\":63,\"type\":\"string\",\"name\":\"v63\"},{\"index\":64,\"type\":\"string\",\"name\":\"v64\"},{\"index\":67,\"type\":\"string\",\"name\":\"v67\"},{\"index\":68,\"type\":\"string\",\"name\":\"v68\"},{\"index\":69,\"type\":\"string\",\"name\":\"v69\"},{\"index\":70,\"type\":\"string\",\"name\":\"v70\"},{\"index\":71,\"type\":\"string\",\"name\":\"v71\"},{\"index\":72,\"type\":\"string\",\"name\":\"v72\"},{\"index\":73,\"type\":\"string\",\"name\":\"v73\"},{\"index\":74,\"type\":\"string\",\"name\":\"v74\"},{\"index\":75,\"type\":\"string\",\"name\":\"v75\"},{\"index\":76,\"type\":\"string\",\"name\":\"v76\"},{\"index\":77,\"type\":\"string\",\"name\":\"v77\"},{\"index\":80,\"type\":\"string\",\"name\":\"mes0\"},{\"index\":81,\"type\":\"string\",\"name\":\"mes1\"},{\"index\":82,\"type\":\"string\",\"name\":\"mes2\"},{\"index\":83,\"type\":\"string\",\"name\":\"hotel_yes\"},{\"index\":84,\"type\":\"string\",\"name\":\"hotel_no\"},{\"index\":85,\"type\":\"string\",\"name\":\"v85\"},{\"index\":86,\"type\":\"string\",\"name\":\"v86\"},{\"index\":87,\"type\":\"string\",\"name\":\"v87\"},{\"index\":88,\"type\":\"string\",\"name\":\"v88\"},{\"index\":89,\"type\":\"string\",\"name\":\"v89\"},{\"index\":92,\"type\":\"string\",\"name\":\"item_owned_num\"},{\"index\":93,\"type\":\"string\",\"name\":\"item_equiped_num\"},{\"index\":95,\"type\":\"string\",\"name\":\"currency\"},{\"index\":101,\"type\":\"string\",\"name\":\"battle\"},{\"index\":102,\"type\":\"string\",\"name\":\"auto_action\"},{\"index\":103,\"type\":\"string\",\"name\":\"escape\"},{\"index\":104,\"type\":\"string\",\"name\":\"attack_command\"},{\"index\":105,\"type\":\"string\",\"name\":\"command_defend\"},{\"index\":106,\"type\":\"string\",\"name\":\"command_item\"},{\"index\":107,\"type\":\"string\",\"name\":\"command_skill\"},{\"index\":108,\"type\":\"string\",\"name\":\"menu_equipment\"},{\"index\":110,\"type\":\"string\",\"name\":\"menu_save\"},{\"index\":112,\"type\":\"string\",\"name\":\"menu_quit\"},{\"index\":114,\"type\":\"string\",\"name\":\"new_game\"},{\"index\":115,\"type\":\"string\",\"name\":\"load_game\"},{\"index\":117,\"type\":\"string\",\"name\":\"exit_game\"},{\"index\":123,\"type\":\"string\",\"name\":\"level\"},{\"index\":124,\"type\":\"string\",\"name\":\"hp\"},{\"index\":125,\"type\":\"string\",\"name\":\"mp\"},{\"index\":126,\"type\":\"string\",\"name\":\"normal_status\"},{\"index\":127,\"type\":\"string\",\"name\":\"exp_short\"},{\"index\":128,\"type\":\"string\",\"name\":\"level_short\"},{\"index\":129,\"type\":\"string\",\"name\":\"hp_short\"},{\"index\":130,\"type\":\"string\",\"name\":\"sp_short\"},{\"index\":131,\"type\":\"string\",\"name\":\"using_mp\"},{\"index\":132,\"type\":\"string\",\"name\":\"attack\"},{\"index\":133,\"type\":\"string\",\"name\":\"defence\"},{\"index\":134,\"type\":\"string\",\"name\":\"mind\"},{\"index\":135,\"type\":\"string\",\"name\":\"speed\"},{\"index\":136,\"type\":\"string\",\"name\":\"weapon\"},{\"index\":137,\"type\":\"string\",\"name\":\"shield\"},{\"index\":138,\"type\":\"string\",\"name\":\"armor\"},{\"index\":139,\"type\":\"string\",\"name\":\"helmet\"},{\"index\":140,\"type\":\"string\",\"name\":\"other\"},{\"index\":146,\"type\":\"string\",\"name\":\"save_select_message\"},{\"index\":147,\"type\":\"string\",\"name\":\"load_select_message\"},{\"index\":148,\"type\":\"string\",\"name\":\"save_data_prefix\"},{\"index\":151,\"type\":\"string\",\"name\":\"exit_game_message\"},{\"index\":152,\"type\":\"string\",\"name\":\"yes\"},{\"index\":153,\"type\":\"string\",\"name\":\"no\"}]},{\"index\":22,\"type\":\"array1d\",\"name\":\"system\",\"value\":[{\"index\":10,\"type\":\"integer\",\"name\":\"version\",\"value\":2000},{\"index\":11,\"type\":\"string\",\"name\":\"boat\"},{\"index\":12,\"type\":\"string\",\"name\":\"ship\"},{\"index\":13,\"type\":\"string\",\"name\":\"airship\"},{\"index\":14,\"type\":\"integer\",\"name\":\"boat_pos\"},{\"index\":15,\"type\":\"integer\",\"name\":\"ship_pos\"},{\"index\":16,\"type\":\"integer\",\"name\":\"airship_pos\"},{\"index\":17,\"type\":\"string\",\"name\":\"title\"},{\"index\":18,\"type\":\"string\",\"name\":\"game_over\"},{\"index\":19,\"type\":\"string\",\"name\":\"system\"},{\"index\":20,\"type\":\"string\",\"name\":\"system_2\"},{\"index\":21,\"type\":\"integer\",\"name\":\"member_num\",\"value\":0},{\"index\":22,\"type\":\"int16array\",\"name\":\"member\"},{\"index\":26,\"type\":\"integer\",\"name\":\"menu_command_size\"},{\"index\":27,\"type\":\"int16array\",\"name\":\"menu_command\"},{\"index\":31,\"type\":\"music\",\"name\":\"title_music\"},{\"index\":32,\"type\":\"music\",\"name\":\"battle_music\"},{\"index\":33,\"type\":\"music\",\"name\":\"battle_end_music\"},{\"index\":34,\"type\":\"music\",\"name\":\"inn_music\"},{\"index\":35,\"type\":\"music\",\"name\":\"boat_music\"},{\"index\":36,\"type\":\"music\",\"name\":\"ship_music\"},{\"index\":37,\"type\":\"music\",\"name\":\"airship_music\"},{\"index\":38,\"type\":\"music\",\"name\":\"game_over_music\"},{\"index\":41,\"type\":\"sound\",\"name\":\"cursor_se\"},{\"index\":42,\"type\":\"sound\",\"name\":\"decision_se\"},{\"index\":43,\"type\":\"sound\",\"name\":\"cancel_se\"},{\"index\":44,\"type\":\"sound\",\"name\":\"buzzer_se\"},{\"index\":45,\"type\":\"sound\",\"name\":\"battle_start_se\"},{\"index\":46,\"type\":\"sound\",\"name\":\"escape_se\"},{\"index\":47,\"type\":\"sound\",\"name\":\"enemy_attack_se\"},{\"index\":48,\"type\":\"sound\",\"name\":\"enemy_damaged_se\"},{\"index\":49,\"type\":\"sound\",\"name\":\"member_damaged_se\"},{\"index\":50,\"type\":\"sound\",\"name\":\"evasion_se\"},{\"index\":51,\"type\":\"sound\",\"name\":\"enemy_defeat_se\"},{\"index\":52,\"type\":\"sound\",\"name\":\"use_item_se\"},{\"index\":61,\"type\":\"integer\",\"name\":\"transition_out\",\"value\":0},{\"index\":62,\"type\":\"integer\",\"name\":\"transition_in\",\"value\":0},{\"index\":63,\"type\":\"integer\",\"name\":\"battle_start_erace\",\"value\":0},{\"index\":64,\"type\":\"integer\",\"name\":\"battle_start_display\",\"value\":0},{\"index\":65,\"type\":\"integer\",\"name\":\"battle_end_erace\",\"value\":0},{\"index\":66,\"type\":\"integer\",\"name\":\"battle_end_display\",\"value\":0},{\"index\":71,\"type\":\"integer\",\"name\":\"wallpaper\",\"value\":0},{\"index\":72,\"type\":\"integer\",\"name\":\"font\",\"value\":0},{\"index\":81,\"type\":\"integer\",\"name\":\"test_condition\"},{\"index\":82,\"type\":\"bool\",\"name\":\"selected_character\"},{\"index\":83,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":84,\"type\":\"string\",\"name\":\"default_backdrop\"},{\"index\":85,\"type\":\"array2d\",\"name\":\"test_battle\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"actor_id\",\"value\":1},{\"index\":2,\"type\":\"integer\",\"name\":\"level\",\"value\":1},{\"index\":11,\"type\":\"integer\",\"name\":\"weapon\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"shield\",\"value\":0},{\"index\":13,\"type\":\"integer\",\"name\":\"armor\",\"value\":0},{\"index\":14,\"type\":\"integer\",\"name\":\"helmet\",\"value\":0},{\"index\":15,\"type\":\"integer\",\"name\":\"accessory\",\"value\":0}]},{\"index\":91,\"type\":\"integer\",\"name\":\"save_time\"}]},{\"index\":23,\"type\":\"array2d\",\"name\":\"switch\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"}]},{\"index\":24,\"type\":\"array2d\",\"name\":\"variable\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"}]},{\"index\":25,\"type\":\"common_event\",\"name\":\"common_event\"},{\"index\":26,\"type\":\"common_event\",\"name\":\"common_event_2\"},{\"index\":27,\"type\":\"common_event\",\"name\":\"common_event_3\"},{\"index\":28,\"type\":\"common_event\",\"name\":\"common_event_4\"},{\"index\":29,\"type\":\"array2d\",\"name\":\"battle_command\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"integer\",\"name\":\"type\"}]},{\"index\":30,\"type\":\"class\",\"name\":\"class_1\"},{\"index\":31,\"type\":\"class\",\"name\":\"class_2\"},{\"index\":32,\"type\":\"array2d\",\"name\":\"battle_anime2\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"integer\",\"name\":\"attack_motion\"},{\"index\":11,\"type\":\"array2d\",\"name\":\"basic\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"battle\"},{\"index\":3,\"type\":\"integer\",\"name\":\"battle_pos\"},{\"index\":4,\"type\":\"bool\",\"name\":\"use_extended_animation\"},{\"index\":5,\"type\":\"integer\",\"name\":\"extended_animation_id\"}]},{\"index\":12,\"type\":\"array2d\",\"name\":\"weapon\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\",\"value\":\"\"},{\"index\":2,\"type\":\"string\",\"name\":\"file\"},{\"index\":3,\"type\":\"integer\",\"name\":\"index\"},{\"index\":4,\"type\":\"bool\",\"name\":\"use_extended_animation\"},{\"index\":5,\"type\":\"integer\",\"name\":\"extended_animation_id\"}]}]}]}]}",
+field const fields_0[] = {
+  { 1, "level", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 2, "skill_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+};
+field const* const by_index_0[] = { NULL, &fields_0[0], &fields_0[1] };
+int16_t const names_0[] = { 1, -1, 0, -1 };
+uint32_t const disp_0[] = { 2 };
+table const table_0 = { "skill", fields_0, 2, by_index_0, 2, names_0, 3, disp_0, 0 };
+
+field const fields_1[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "title", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "charset", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 4, "charset_index", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 5, "semi_trans", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 7, "start_level", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 8, "final_level", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 9, "critical", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 10, "critical_rate", LCF::schema::integer, NULL, true, 30, 0.0, NULL },
+  { 15, "faceset", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 16, "faceset_index", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 21, "double_hand", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 22, "equip_fix", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 23, "ai_action", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 24, "strong_defence", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 31, "parameter", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 41, "exp_base", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 42, "exp_inflation", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 43, "exp_correction", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 51, "equipment", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 56, "unarmed_attack", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 57, "job", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 58, "battle_anime", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 60, "battle_x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 61, "battle_y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 62, "attack_anime", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 63, "skill", LCF::schema::array2d, &table_0, false, 0, 0.0, NULL },
+  { 66, "use_original_command", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 67, "original_command", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 71, "condition_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 72, "condition_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 73, "attrib_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 74, "attrib_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 80, "battle_command", LCF::schema::int32array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_1[] = { NULL, &fields_1[0], &fields_1[1], &fields_1[2], &fields_1[3], &fields_1[4], NULL, &fields_1[5], &fields_1[6], &fields_1[7], &fields_1[8], NULL, NULL, NULL, NULL, &fields_1[9], &fields_1[10], NULL, NULL, NULL, NULL, &fields_1[11], &fields_1[12], &fields_1[13], &fields_1[14], NULL, NULL, NULL, NULL, NULL, NULL, &fields_1[15], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_1[16], &fields_1[17], &fields_1[18], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_1[19], NULL, NULL, NULL, NULL, &fields_1[20], &fields_1[21], &fields_1[22], NULL, &fields_1[23], &fields_1[24], &fields_1[25], &fields_1[26], NULL, NULL, &fields_1[27], &fields_1[28], NULL, NULL, NULL, &fields_1[29], &fields_1[30], &fields_1[31], &fields_1[32], NULL, NULL, NULL, NULL, NULL, &fields_1[33] };
+int16_t const names_1[] = { -1, -1, -1, -1, -1, 13, -1, -1, 30, 18, -1, -1, -1, -1, 16, -1, -1, -1, -1, -1, 24, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 33, -1, -1, -1, -1, -1, 21, -1, -1, -1, -1, 10, -1, -1, 3, -1, 27, -1, -1, 8, 9, -1, 23, -1, -1, -1, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 26, 31, 20, -1, -1, -1, -1, -1, 5, 28, 29, -1, -1, 19, -1, 6, 11, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, 25, -1, -1, -1, -1, -1, -1, -1, 2, 1, 4, -1, -1, 15, 7, -1, 32, 17, -1 };
+uint32_t const disp_1[] = { 0, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0, 1, 4, 0, 1, 1 };
+table const table_1 = { "actor", fields_1, 34, by_index_1, 80, names_1, 127, disp_1, 31 };
+
+field const fields_2[] = {
+  { 1, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "volume", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 4, "tempo", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 5, "balance", LCF::schema::integer, NULL, true, 50, 0.0, NULL },
+};
+field const* const by_index_2[] = { NULL, &fields_2[0], NULL, &fields_2[1], &fields_2[2], &fields_2[3] };
+int16_t const names_2[] = { -1, 0, 2, -1, 1, -1, 3, -1 };
+uint32_t const disp_2[] = { 1, 1 };
+table const table_2 = { "sound", fields_2, 4, by_index_2, 5, names_2, 7, disp_2, 1 };
+
+field const fields_3[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "comment", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "message_l1", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 4, "message_l2", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 7, "message_failed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 8, "type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 11, "using_mp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "range", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 13, "switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 14, "anime_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 16, "sound", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 18, "use_at_field", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 19, "use_at_battle", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 20, "condition_effect", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 21, "blow_relation", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 22, "mental_relation", LCF::schema::integer, NULL, true, 3, 0.0, NULL },
+  { 23, "effect_variance", LCF::schema::integer, NULL, true, 4, 0.0, NULL },
+  { 24, "basic_effect", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 25, "succeed_rate", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 31, "affect_hp", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 32, "affect_mp", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 33, "affect_attack", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 34, "affect_defence", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 35, "affect_mental", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 36, "affect_speed", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 37, "absorption", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 38, "ignore_defence", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 41, "condition_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 42, "condition_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 43, "attrib_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 44, "attrib_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 45, "change_attrib", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_3[] = { NULL, &fields_3[0], &fields_3[1], &fields_3[2], &fields_3[3], NULL, NULL, &fields_3[4], &fields_3[5], NULL, NULL, &fields_3[6], &fields_3[7], &fields_3[8], &fields_3[9], NULL, &fields_3[10], NULL, &fields_3[11], &fields_3[12], &fields_3[13], &fields_3[14], &fields_3[15], &fields_3[16], &fields_3[17], &fields_3[18], NULL, NULL, NULL, NULL, NULL, &fields_3[19], &fields_3[20], &fields_3[21], &fields_3[22], &fields_3[23], &fields_3[24], &fields_3[25], &fields_3[26], NULL, NULL, &fields_3[27], &fields_3[28], &fields_3[29], &fields_3[30], &fields_3[31] };
+int16_t const names_3[] = { 31, 1, 27, -1, -1, 8, 6, -1, 28, 0, -1, -1, -1, -1, 2, -1, 7, -1, -1, 29, -1, -1, 17, 23, -1, 24, 5, 20, -1, -1, 15, -1, 4, -1, -1, 10, 19, -1, -1, -1, 26, 16, 30, -1, 13, -1, -1, 14, 22, 25, -1, -1, 18, -1, 9, 11, -1, -1, 21, -1, 12, -1, 3, -1 };
+uint32_t const disp_3[] = { 3, 3, 1, 3, 2, 2, 1, 0, 2, 6, 1, 2, 1, 6, 2, 1 };
+table const table_3 = { "skill", fields_3, 32, by_index_3, 45, names_3, 63, disp_3, 15 };
+
+field const fields_4[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "comment", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 5, "price", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 6, "usable_time", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 11, "attack", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "defence", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 13, "mind", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 14, "speed", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 15, "hand", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 16, "using_mp", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 17, "hit_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 18, "critical_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 20, "anime_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 21, "first_strike", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 22, "double_attack", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 23, "attack_all", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 24, "ignore_evasion_rate", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 25, "prevent_critical", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 26, "increase_evasion_rate", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 27, "half_using_mp_", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 28, "ignore_terrain_damage", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 29, "fix_equipment", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 31, "effect_range", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 32, "hp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 33, "hp_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 34, "mp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 35, "mp_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 37, "only_at_field", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 38, "only_for_knockouts", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 41, "increase_hp", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 42, "increase_mp", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 43, "increase_attack", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 44, "increase_defence", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 45, "increase_mind", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 46, "increase_speed", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 51, "message_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 53, "skill_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 55, "switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 57, "use_at_field", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 59, "use_at_battle", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 61, "equip_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 62, "equip_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 63, "condition_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 64, "condition_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 65, "attrib_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 66, "attrib_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 67, "condition_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 68, "condition_flip", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 69, "use_anime_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 71, "use_skill_as_item", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 72, "job_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 73, "job_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_4[] = { NULL, &fields_4[0], &fields_4[1], &fields_4[2], NULL, &fields_4[3], &fields_4[4], NULL, NULL, NULL, NULL, &fields_4[5], &fields_4[6], &fields_4[7], &fields_4[8], &fields_4[9], &fields_4[10], &fields_4[11], &fields_4[12], NULL, &fields_4[13], &fields_4[14], &fields_4[15], &fields_4[16], &fields_4[17], &fields_4[18], &fields_4[19], &fields_4[20], &fields_4[21], &fields_4[22], NULL, &fields_4[23], &fields_4[24], &fields_4[25], &fields_4[26], &fields_4[27], NULL, &fields_4[28], &fields_4[29], NULL, NULL, &fields_4[30], &fields_4[31], &fields_4[32], &fields_4[33], &fields_4[34], &fields_4[35], NULL, NULL, NULL, NULL, &fields_4[36], NULL, &fields_4[37], NULL, &fields_4[38], NULL, &fields_4[39], NULL, &fields_4[40], NULL, &fields_4[41], &fields_4[42], &fields_4[43], &fields_4[44], &fields_4[45], &fields_4[46], &fields_4[47], &fields_4[48], &fields_4[49], NULL, &fields_4[50], &fields_4[51], &fields_4[52] };
+int16_t const names_4[] = { 20, 42, 1, 29, -1, -1, -1, -1, 44, 32, -1, -1, -1, -1, -1, 31, -1, -1, -1, -1, -1, 4, -1, -1, 52, -1, -1, -1, -1, 5, -1, -1, 25, -1, 11, -1, -1, -1, 37, 9, 17, -1, 15, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, 12, 13, 39, 10, 22, 51, 26, -1, 18, 24, -1, 28, -1, 2, -1, -1, 38, -1, -1, -1, 0, -1, -1, 33, 45, -1, 27, 49, -1, -1, -1, -1, -1, -1, -1, 34, 6, -1, 40, 43, 14, 35, -1, -1, 30, -1, -1, -1, -1, -1, -1, -1, 19, 47, -1, -1, -1, 21, 7, -1, -1, -1, -1, -1, 36, -1, 41, 8, 23, -1, 50, 16, 46, 48, -1 };
+uint32_t const disp_4[] = { 0, 1, 2, 1, 0, 3, 1, 1, 2, 1, 0, 0, 1, 1, 2, 2, 0, 2, 1, 1, 2, 1, 1, 0, 3, 2, 1, 1, 3, 2, 7, 1 };
+table const table_4 = { "item", fields_4, 53, by_index_4, 73, names_4, 127, disp_4, 31 };
+
+field const fields_5[] = {
+  { 1, "action_type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 2, "basic_action", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 3, "skill_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 4, "enemy_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 5, "action_term", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 6, "a", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 7, "b", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 8, "switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 9, "on_after_action", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 10, "on_switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 11, "off_after_action", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 12, "off_switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 13, "priority", LCF::schema::integer, NULL, true, 50, 0.0, NULL },
+};
+field const* const by_index_5[] = { NULL, &fields_5[0], &fields_5[1], &fields_5[2], &fields_5[3], &fields_5[4], &fields_5[5], &fields_5[6], &fields_5[7], &fields_5[8], &fields_5[9], &fields_5[10], &fields_5[11], &fields_5[12] };
+int16_t const names_5[] = { 7, -1, 2, -1, 0, -1, 11, 6, -1, 10, -1, 3, 5, -1, -1, 4, -1, -1, -1, -1, 8, -1, -1, -1, 1, 9, -1, -1, -1, -1, 12, -1 };
+uint32_t const disp_5[] = { 1, 1, 1, 3, 1, 0, 3, 2 };
+table const table_5 = { "actions", fields_5, 13, by_index_5, 13, names_5, 31, disp_5, 7 };
+
+field const fields_6[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "monster", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "hue", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 4, "hp", LCF::schema::integer, NULL, true, 10, 0.0, NULL },
+  { 5, "mp", LCF::schema::integer, NULL, true, 10, 0.0, NULL },
+  { 6, "attack", LCF::schema::integer, NULL, true, 10, 0.0, NULL },
+  { 7, "defence", LCF::schema::integer, NULL, true, 10, 0.0, NULL },
+  { 8, "mind", LCF::schema::integer, NULL, true, 10, 0.0, NULL },
+  { 9, "speed", LCF::schema::integer, NULL, true, 10, 0.0, NULL },
+  { 10, "semi_trans", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 11, "exp", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "money", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 13, "dropping_item_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 14, "item_drop_rate", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 21, "critical", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 22, "critical_rate", LCF::schema::integer, NULL, true, 30, 0.0, NULL },
+  { 26, "increase_miss", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 28, "in_the_air", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 31, "condition_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 32, "condition_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 33, "attrib_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 34, "attrib_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 42, "actions", LCF::schema::array2d, &table_5, false, 0, 0.0, NULL },
+};
+field const* const by_index_6[] = { NULL, &fields_6[0], &fields_6[1], &fields_6[2], &fields_6[3], &fields_6[4], &fields_6[5], &fields_6[6], &fields_6[7], &fields_6[8], &fields_6[9], &fields_6[10], &fields_6[11], &fields_6[12], &fields_6[13], NULL, NULL, NULL, NULL, NULL, NULL, &fields_6[14], &fields_6[15], NULL, NULL, NULL, &fields_6[16], NULL, &fields_6[17], NULL, NULL, &fields_6[18], &fields_6[19], &fields_6[20], &fields_6[21], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_6[22] };
+int16_t const names_6[] = { -1, -1, -1, -1, -1, -1, -1, -1, 19, 0, 22, -1, -1, -1, -1, 7, -1, -1, -1, 20, -1, -1, -1, -1, -1, 6, -1, -1, 18, 5, 4, -1, -1, 8, -1, 1, -1, 17, -1, -1, -1, -1, -1, 15, -1, 16, 10, 3, 12, -1, -1, -1, -1, -1, 11, 9, -1, -1, 13, 14, 2, 21, -1, -1 };
+uint32_t const disp_6[] = { 0, 0, 1, 3, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1 };
+table const table_6 = { "enemy", fields_6, 23, by_index_6, 42, names_6, 63, disp_6, 15 };
+
+field const fields_7[] = {
+  { 1, "enemy_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 2, "x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 4, "invisible", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_7[] = { NULL, &fields_7[0], &fields_7[1], &fields_7[2], &fields_7[3] };
+int16_t const names_7[] = { 2, -1, 3, 1, -1, -1, 0, -1 };
+uint32_t const disp_7[] = { 1, 1 };
+table const table_7 = { "enemy_enum", fields_7, 4, by_index_7, 4, names_7, 7, disp_7, 1 };
+
+field const fields_8[] = {
+  { 1, "flags", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 2, "switch_id1", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 3, "switch_id2", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 4, "variable_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 5, "variable_value", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 6, "trun_freq", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 7, "turn_offset", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 8, "fatigue_min", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 9, "fatigue_max", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 10, "enemy_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 11, "enemy_hp_min", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "enemy_hp_max", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 13, "proponent_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 14, "proponent_hp_from", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 15, "proponent_hp_to", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 16, "turn_freq", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 17, "turn_offset", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 18, "turn_freq", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 19, "turn_offset", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 20, "turn_freq", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 21, "turn_offset", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 22, "trun_freq", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 23, "turn_offset", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_8[] = { NULL, &fields_8[0], &fields_8[1], &fields_8[2], &fields_8[3], &fields_8[4], &fields_8[5], &fields_8[6], &fields_8[7], &fields_8[8], &fields_8[9], &fields_8[10], &fields_8[11], &fields_8[12], &fields_8[13], &fields_8[14], &fields_8[15], &fields_8[16], &fields_8[17], &fields_8[18], &fields_8[19], &fields_8[20], &fields_8[21], &fields_8[22] };
+int16_t const names_8[] = { 4, -1, -1, -1, -1, 0, -1, 13, 7, 1, -1, 12, -1, 11, 14, 15, 3, 2, -1, 9, -1, 6, 8, 10, -1, 5, -1, -1, -1, -1, -1, -1 };
+uint32_t const disp_8[] = { 0, 0, 1, 2, 1, 1, 1, 1 };
+table const table_8 = { "term", fields_8, 23, by_index_8, 23, names_8, 31, disp_8, 7 };
+
+field const fields_9[] = {
+  { 2, "term", LCF::schema::array1d, &table_8, false, 0, 0.0, NULL },
+  { 11, "event_length", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "event", LCF::schema::event, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_9[] = { NULL, NULL, &fields_9[0], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_9[1], &fields_9[2] };
+int16_t const names_9[] = { -1, -1, -1, -1, 2, 1, 0, -1 };
+uint32_t const disp_9[] = { 1, 1 };
+table const table_9 = { "battle_event", fields_9, 3, by_index_9, 12, names_9, 7, disp_9, 1 };
+
+field const fields_10[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "enemy_enum", LCF::schema::array2d, &table_7, false, 0, 0.0, NULL },
+  { 4, "terrain_data_num", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 5, "terrain_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 11, "battle_event", LCF::schema::array2d, &table_9, false, 0, 0.0, NULL },
+};
+field const* const by_index_10[] = { NULL, &fields_10[0], &fields_10[1], NULL, &fields_10[2], &fields_10[3], NULL, NULL, NULL, NULL, NULL, &fields_10[4] };
+int16_t const names_10[] = { -1, -1, -1, -1, -1, 4, 3, -1, -1, 0, 1, -1, -1, -1, 2, -1 };
+uint32_t const disp_10[] = { 1, 1, 1, 2 };
+table const table_10 = { "enemy_group", fields_10, 5, by_index_10, 11, names_10, 15, disp_10, 3 };
+
+field const fields_11[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "damage", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "rate", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 4, "backdrop", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 5, "boat", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 6, "ship", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 7, "airship", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 9, "airship_land", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 11, "char_view_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 15, "footstep", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 16, "on_damage_se", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 17, "background_type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 21, "background_a_name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 22, "background_a_scrollh", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 23, "background_a_scrollv", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 24, "background_a_scrollh_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 25, "background_a_scrollv_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 30, "background_b", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 31, "background_b_name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 32, "background_b_scrollh", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 33, "background_b_scrollv", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 34, "background_b_scrollh_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 35, "background_b_scrollv_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 40, "special_flags", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 41, "special_back_party", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 42, "special_back_enemies", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 43, "special_lateral_party", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 44, "special_lateral_enemies", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 45, "grid_location", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 46, "grid_a", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 47, "grid_b", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 48, "grid_c", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_11[] = { NULL, &fields_11[0], &fields_11[1], &fields_11[2], &fields_11[3], &fields_11[4], &fields_11[5], &fields_11[6], NULL, &fields_11[7], NULL, &fields_11[8], NULL, NULL, NULL, &fields_11[9], &fields_11[10], &fields_11[11], NULL, NULL, NULL, &fields_11[12], &fields_11[13], &fields_11[14], &fields_11[15], &fields_11[16], NULL, NULL, NULL, NULL, &fields_11[17], &fields_11[18], &fields_11[19], &fields_11[20], &fields_11[21], &fields_11[22], NULL, NULL, NULL, NULL, &fields_11[23], &fields_11[24], &fields_11[25], &fields_11[26], &fields_11[27], &fields_11[28], &fields_11[29], &fields_11[30], &fields_11[31] };
+int16_t const names_11[] = { -1, 6, -1, -1, 16, -1, -1, -1, 12, 0, -1, -1, -1, 5, -1, -1, -1, 24, -1, 10, -1, 26, 29, -1, 11, 25, -1, 4, -1, -1, 14, 31, 3, -1, 9, 13, -1, 19, -1, 20, -1, -1, -1, 15, -1, -1, 17, 23, 28, -1, 22, 1, -1, 7, -1, -1, 27, 18, -1, -1, 2, 21, 8, 30 };
+uint32_t const disp_11[] = { 5, 1, 1, 0, 1, 1, 1, 1, 1, 2, 1, 1, 4, 3, 1, 1 };
+table const table_11 = { "terrain", fields_11, 32, by_index_11, 48, names_11, 63, disp_11, 15 };
+
+field const fields_12[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 11, "rate_a", LCF::schema::integer, NULL, true, 300, 0.0, NULL },
+  { 12, "rate_b", LCF::schema::integer, NULL, true, 200, 0.0, NULL },
+  { 13, "rate_c", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 14, "rate_d", LCF::schema::integer, NULL, true, 50, 0.0, NULL },
+  { 15, "rate_e", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_12[] = { NULL, &fields_12[0], &fields_12[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_12[2], &fields_12[3], &fields_12[4], &fields_12[5], &fields_12[6] };
+int16_t const names_12[] = { 6, -1, -1, -1, 5, 1, -1, 2, -1, 0, 3, -1, 4, -1, -1, -1 };
+uint32_t const disp_12[] = { 2, 2, 1, 2 };
+table const table_12 = { "attribute", fields_12, 7, by_index_12, 15, names_12, 15, disp_12, 3 };
+
+field const fields_13[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "color", LCF::schema::integer, NULL, true, 6, 0.0, NULL },
+  { 4, "priority", LCF::schema::integer, NULL, true, 50, 0.0, NULL },
+  { 5, "restrict", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 11, "rate_a", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 12, "rate_b", LCF::schema::integer, NULL, true, 80, 0.0, NULL },
+  { 13, "rate_c", LCF::schema::integer, NULL, true, 60, 0.0, NULL },
+  { 14, "rate_d", LCF::schema::integer, NULL, true, 30, 0.0, NULL },
+  { 15, "rate_e", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 21, "cure_turn", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 22, "cure_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 23, "shock_cure_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 31, "attack", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 32, "defence", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 33, "mind", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 34, "speed", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 35, "hit_rate", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 41, "disable_blow_skill", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 42, "blow_relation", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 43, "disable_mind_skill", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 44, "mind_relation", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 51, "message_member", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 52, "message_enemy", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 53, "message_already", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 54, "message_last", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 55, "message_cure", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 61, "turn_hp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 62, "turn_hp_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 63, "field_hp_step", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 64, "field_hp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 65, "turn_mp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 66, "turn_mp_rate", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 67, "field_mp_step", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 68, "field_mp_amount", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_13[] = { NULL, &fields_13[0], &fields_13[1], &fields_13[2], &fields_13[3], &fields_13[4], NULL, NULL, NULL, NULL, NULL, &fields_13[5], &fields_13[6], &fields_13[7], &fields_13[8], &fields_13[9], NULL, NULL, NULL, NULL, NULL, &fields_13[10], &fields_13[11], &fields_13[12], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_13[13], &fields_13[14], &fields_13[15], &fields_13[16], &fields_13[17], NULL, NULL, NULL, NULL, NULL, &fields_13[18], &fields_13[19], &fields_13[20], &fields_13[21], NULL, NULL, NULL, NULL, NULL, NULL, &fields_13[22], &fields_13[23], &fields_13[24], &fields_13[25], &fields_13[26], NULL, NULL, NULL, NULL, NULL, &fields_13[27], &fields_13[28], &fields_13[29], &fields_13[30], &fields_13[31], &fields_13[32], &fields_13[33], &fields_13[34] };
+int16_t const names_13[] = { -1, 30, 3, -1, -1, -1, -1, -1, -1, -1, 6, 34, -1, -1, 18, 15, -1, -1, 9, 32, 8, -1, -1, -1, -1, -1, -1, 26, -1, 13, 0, 14, -1, -1, -1, -1, 10, -1, -1, -1, 19, -1, -1, -1, 7, -1, -1, -1, -1, -1, 33, 12, -1, -1, 25, -1, -1, -1, -1, -1, -1, 20, 5, -1, -1, -1, 1, -1, -1, 11, -1, 23, -1, -1, 4, 31, -1, 21, -1, -1, -1, 27, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, 17, -1, -1, 29, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 24, -1, 2, -1, -1, -1, -1, -1, 16, -1, 28, -1, -1, -1, -1, -1 };
+uint32_t const disp_13[] = { 1, 0, 0, 1, 1, 1, 3, 0, 0, 1, 0, 2, 2, 1, 1, 1, 2, 0, 2, 1, 2, 0, 2, 0, 1, 2, 0, 0, 1, 0, 1, 1 };
+table const table_13 = { "condition", fields_13, 35, by_index_13, 68, names_13, 127, disp_13, 31 };
+
+field const fields_14[] = {
+  { 1, "frame_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 2, "sound", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 3, "range", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 4, "red", LCF::schema::integer, NULL, true, 31, 0.0, NULL },
+  { 5, "green", LCF::schema::integer, NULL, true, 31, 0.0, NULL },
+  { 6, "blue", LCF::schema::integer, NULL, true, 31, 0.0, NULL },
+  { 7, "flash", LCF::schema::integer, NULL, true, 31, 0.0, NULL },
+};
+field const* const by_index_14[] = { NULL, &fields_14[0], &fields_14[1], &fields_14[2], &fields_14[3], &fields_14[4], &fields_14[5], &fields_14[6] };
+int16_t const names_14[] = { 2, 3, -1, -1, -1, 0, -1, 1, 4, -1, -1, -1, 5, 6, -1, -1 };
+uint32_t const disp_14[] = { 4, 2, 2, 1 };
+table const table_14 = { "Effect", fields_14, 7, by_index_14, 7, names_14, 15, disp_14, 3 };
 
-  "{\"signature\":\"LcfMapTree\",\"root\":[{\"type\":\"array2d\",\"name\":\"global\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\"},{\"index\":2,\"type\":\"integer\",\"name\":\"parent\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"indentation\"},{\"index\":4,\"type\":\"integer\",\"name\":\"type\"},{\"index\":5,\"type\":\"integer\",\"name\":\"scrollbar_x\"},{\"index\":6,\"type\":\"integer\",\"name\":\"scrollbar_y\"},{\"index\":7,\"type\":\"bool\",\"name\":\"expanded\",\"value\":false},{\"index\":11,\"type\":\"integer\",\"name\":\"music_type\"},{\"index\":12,\"type\":\"music\",\"name\":\"music\"},{\"index\":21,\"type\":\"integer\",\"name\":\"backdrop_type\"},{\"index\":22,\"type\":\"string\",\"name\":\"backdrop\"},{\"index\":31,\"type\":\"integer\",\"name\":\"teleport\"},{\"index\":32,\"type\":\"integer\",\"name\":\"escape\"},{\"index\":33,\"type\":\"integer\",\"name\":\"save\"},{\"index\":41,\"type\":\"array2d\",\"name\":\"encount\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"enemy_group_id\"}]},{\"index\":44,\"type\":\"integer\",\"name\":\"encounter_steps\",\"value\":25},{\"index\":51,\"type\":\"int32array\",\"name\":\"area_range\"}]},{\"type\":\"map_tree\",\"name\":\"map_tree\"},{\"type\":\"array1d\",\"name\":\"start_point\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"party_map_id\"},{\"index\":2,\"type\":\"integer\",\"name\":\"party_x\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"party_y\",\"value\":0},{\"index\":11,\"type\":\"integer\",\"name\":\"boat_map_id\",\"value\":0},{\"index\":12,\"type\":\"integer\",\"name\":\"boat_x\",\"value\":0},{\"index\":13,\"type\":\"integer\",\"name\":\"boat_y\",\"value\":0},{\"index\":21,\"type\":\"integer\",\"name\":\"ship_map_id\",\"value\":0},{\"index\":22,\"type\":\"integer\",\"name\":\"ship_x\",\"value\":0},{\"index\":23,\"type\":\"integer\",\"name\":\"ship_y\",\"value\":0},{\"index\":31,\"type\":\"integer\",\"name\":\"airship_map_id\",\"value\":0},{\"index\":32,\"type\":\"integer\",\"name\":\"airship_x\",\"value\":0},{\"index\":33,\"type\":\"integer\",\"name\":\"airship_y\",\"value\":0}]}]}",
+field const fields_15[] = {
+  { 1, "visible", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 2, "battle_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 3, "x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 4, "y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 5, "zoom", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 6, "red", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 7, "green", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 8, "blue", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 9, "chroma", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 10, "transparency", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_15[] = { NULL, &fields_15[0], &fields_15[1], &fields_15[2], &fields_15[3], &fields_15[4], &fields_15[5], &fields_15[6], &fields_15[7], &fields_15[8], &fields_15[9] };
+int16_t const names_15[] = { -1, -1, -1, -1, -1, 0, 8, -1, 3, -1, -1, -1, -1, 1, -1, -1, 9, 5, 6, 4, -1, -1, -1, -1, 7, -1, -1, 2, -1, -1, -1, -1 };
+uint32_t const disp_15[] = { 1, 1, 1, 2, 1, 1, 2, 1 };
+table const table_15 = { "cell", fields_15, 10, by_index_15, 10, names_15, 31, disp_15, 7 };
+
+field const fields_16[] = {
+  { 1, "cell", LCF::schema::array2d, &table_15, false, 0, 0.0, NULL },
+};
+field const* const by_index_16[] = { NULL, &fields_16[0] };
+int16_t const names_16[] = { 0, -1 };
+uint32_t const disp_16[] = { 1 };
+table const table_16 = { "frame", fields_16, 1, by_index_16, 1, names_16, 1, disp_16, 0 };
+
+field const fields_17[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "battle", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 6, "Effect", LCF::schema::array2d, &table_14, false, 0, 0.0, NULL },
+  { 9, "range", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 10, "y_base", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 11, "use_grid", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "frame", LCF::schema::array2d, &table_16, false, 0, 0.0, NULL },
+};
+field const* const by_index_17[] = { NULL, &fields_17[0], &fields_17[1], NULL, NULL, NULL, &fields_17[2], NULL, NULL, &fields_17[3], &fields_17[4], &fields_17[5], &fields_17[6] };
+int16_t const names_17[] = { -1, -1, -1, 2, -1, 5, -1, 4, -1, 1, 3, -1, 6, -1, 0, -1 };
+uint32_t const disp_17[] = { 0, 1, 2, 1 };
+table const table_17 = { "animation", fields_17, 7, by_index_17, 12, names_17, 15, disp_17, 3 };
+
+field const fields_18[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "chipset", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "terrain_id", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 4, "lower", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 5, "upper", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 11, "ocean_sequence", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "ocean_speed", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_18[] = { NULL, &fields_18[0], &fields_18[1], &fields_18[2], &fields_18[3], &fields_18[4], NULL, NULL, NULL, NULL, NULL, &fields_18[5], &fields_18[6] };
+int16_t const names_18[] = { -1, 1, -1, -1, 5, 6, -1, 3, 4, 0, -1, -1, -1, 2, -1, -1 };
+uint32_t const disp_18[] = { 1, 1, 1, 3 };
+table const table_18 = { "chipset", fields_18, 7, by_index_18, 12, names_18, 15, disp_18, 3 };
 
-  "{\"signature\":\"LcfMapUnit\",\"root\":[{\"type\":\"array1d\",\"name\":\"global\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"chipset_id\",\"value\":1},{\"index\":2,\"type\":\"integer\",\"name\":\"width\",\"value\":20},{\"index\":3,\"type\":\"integer\",\"name\":\"height\",\"value\":15},{\"index\":11,\"type\":\"integer\",\"name\":\"scroll_type\"},{\"index\":31,\"type\":\"bool\",\"name\":\"use_panorama\",\"value\":false},{\"index\":32,\"type\":\"string\",\"name\":\"panorama_name\"},{\"index\":33,\"type\":\"bool\",\"name\":\"panorama_loop_x\",\"value\":false},{\"index\":34,\"type\":\"bool\",\"name\":\"panorama_loop_y\",\"value\":false},{\"index\":35,\"type\":\"bool\",\"name\":\"panorama_auto_loop_x\",\"value\":false},{\"index\":36,\"type\":\"integer\",\"name\":\"panorama_sx\",\"value\":0},{\"index\":37,\"type\":\"bool\",\"name\":\"panorama_auto_loop_y\",\"value\":false},{\"index\":38,\"type\":\"integer\",\"name\":\"panorama_sy\",\"value\":0},{\"index\":71,\"type\":\"int16array\",\"name\":\"lower_layer\"},{\"index\":72,\"type\":\"int16array\",\"name\":\"upper_layer\"},{\"index\":81,\"type\":\"array2d\",\"name\":\"event\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\"},{\"index\":2,\"type\":\"integer\",\"name\":\"x\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"y\",\"value\":0},{\"index\":5,\"type\":\"array2d\",\"name\":\"page\",\"value\":[{\"index\":2,\"type\":\"array1d\",\"name\":\"term\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"flags\",\"value\":0},{\"index\":2,\"type\":\"integer\",\"name\":\"switch_id1\",\"value\":1},{\"index\":3,\"type\":\"integer\",\"name\":\"switch_id2\",\"value\":1},{\"index\":4,\"type\":\"integer\",\"name\":\"variable_id\",\"value\":1},{\"index\":5,\"type\":\"integer\",\"name\":\"variable_value\",\"value\":0},{\"index\":6,\"type\":\"integer\",\"name\":\"item_id\",\"value\":1},{\"index\":7,\"type\":\"integer\",\"name\":\"char_id\",\"value\":1},{\"index\":8,\"type\":\"integer\",\"name\":\"timer_left_1\",\"value\":0},{\"index\":9,\"type\":\"integer\",\"name\":\"timer_left_2\",\"value\":0},{\"index\":10,\"type\":\"integer\",\"name\":\"compare_operator\",\"value\":0}]},{\"index\":21,\"type\":\"string\",\"name\":\"charset\"},{\"index\":22,\"type\":\"integer\",\"name\":\"charset_pos\",\"value\":0},{\"index\":23,\"type\":\"integer\",\"name\":\"charset_dir\",\"value\":2},{\"index\":24,\"type\":\"integer\",\"name\":\"charset_pat\",\"value\":1},{\"index\":25,\"type\":\"bool\",\"name\":\"semi_trans\",\"value\":false},{\"index\":31,\"type\":\"integer\",\"name\":\"action\",\"value\":0},{\"index\":32,\"type\":\"integer\",\"name\":\"frequency\",\"value\":3},{\"index\":33,\"type\":\"integer\",\"name\":\"trigger\",\"value\":0},{\"index\":34,\"type\":\"integer\",\"name\":\"priority_type\",\"value\":0},{\"index\":35,\"type\":\"bool\",\"name\":\"no_pile\",\"value\":false},{\"index\":36,\"type\":\"integer\",\"name\":\"anime_type\",\"value\":0},{\"index\":37,\"type\":\"integer\",\"name\":\"speed\",\"value\":3},{\"index\":41,\"type\":\"array1d\",\"name\":\"move\",\"value\":[{\"index\":11,\"type\":\"integer\",\"name\":\"length\",\"value\":0},{\"index\":12,\"type\":\"ber_array\",\"name\":\"data\"},{\"index\":21,\"type\":\"bool\",\"name\":\"repeat\",\"value\":true},{\"index\":22,\"type\":\"bool\",\"name\":\"skippable\",\"value\":false}]},{\"index\":51,\"type\":\"integer\",\"name\":\"event_length\",\"value\":0},{\"index\":52,\"type\":\"event\",\"name\":\"event\"}]}]},{\"index\":91,\"type\":\"integer\",\"name\":\"save_time\"}]}]}",
+field const fields_19[] = {
+  { 1, "battle_start", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 2, "first_strike", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "escape_success", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 4, "escape_failure", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 5, "battle_won", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 6, "battle_lost", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 7, "gain_exp", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 8, "earn_money_begin", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 9, "earn_money_end", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 10, "item_get", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 11, "normal_attack", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 12, "critical_attack_party", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 13, "critical_attack_enemy", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 14, "defended", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 15, "do_nothing", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 16, "charge_power", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 17, "self_destruct", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 18, "run_away", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 19, "transform", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 20, "damage_to_enemy", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 21, "no_damage_to_enemy", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 22, "damage_to_party", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 23, "no_damage_to_party", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 24, "skill_failure_a", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 25, "skill_failure_b", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 26, "skill_failure_c", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 27, "physical_atrack_failure", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 28, "item_use", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 29, "parameter_recovery", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 30, "parameer_up", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 31, "parameer_down", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 32, "party_abusorb_parameter", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 33, "enemy_abusorb_parameter", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 34, "attribute_gaurd_up", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 35, "attribute_gaurd_down", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 36, "level_up", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 37, "skill_mastered", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 38, "miss", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 41, "select_action", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 42, "select_action_second", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 43, "buy", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 44, "sell", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 45, "cancel", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 46, "select_buying_item", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 47, "buying_item_num", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 48, "end_buy", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 49, "select_selling_item", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 50, "selling_item_num", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 51, "end_sell", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 54, "v54", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 55, "v55", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 56, "v56", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 57, "v57", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 58, "v58", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 59, "v59", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 60, "v60", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 61, "v61", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 62, "v62", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 63, "v63", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 64, "v64", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 67, "v67", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 68, "v68", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 69, "v69", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 70, "v70", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 71, "v71", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 72, "v72", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 73, "v73", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 74, "v74", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 75, "v75", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 76, "v76", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 77, "v77", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 80, "mes0", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 81, "mes1", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 82, "mes2", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 83, "hotel_yes", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 84, "hotel_no", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 85, "v85", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 86, "v86", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 87, "v87", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 88, "v88", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 89, "v89", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 92, "item_owned_num", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 93, "item_equiped_num", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 95, "currency", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 101, "battle", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 102, "auto_action", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 103, "escape", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 104, "attack_command", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 105, "command_defend", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 106, "command_item", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 107, "command_skill", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 108, "menu_equipment", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 110, "menu_save", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 112, "menu_quit", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 114, "new_game", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 115, "load_game", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 117, "exit_game", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 123, "level", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 124, "hp", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 125, "mp", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 126, "normal_status", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 127, "exp_short", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 128, "level_short", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 129, "hp_short", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 130, "sp_short", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 131, "using_mp", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 132, "attack", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 133, "defence", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 134, "mind", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 135, "speed", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 136, "weapon", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 137, "shield", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 138, "armor", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 139, "helmet", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 140, "other", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 146, "save_select_message", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 147, "load_select_message", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 148, "save_data_prefix", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 151, "exit_game_message", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 152, "yes", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 153, "no", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_19[] = { NULL, &fields_19[0], &fields_19[1], &fields_19[2], &fields_19[3], &fields_19[4], &fields_19[5], &fields_19[6], &fields_19[7], &fields_19[8], &fields_19[9], &fields_19[10], &fields_19[11], &fields_19[12], &fields_19[13], &fields_19[14], &fields_19[15], &fields_19[16], &fields_19[17], &fields_19[18], &fields_19[19], &fields_19[20], &fields_19[21], &fields_19[22], &fields_19[23], &fields_19[24], &fields_19[25], &fields_19[26], &fields_19[27], &fields_19[28], &fields_19[29], &fields_19[30], &fields_19[31], &fields_19[32], &fields_19[33], &fields_19[34], &fields_19[35], &fields_19[36], &fields_19[37], NULL, NULL, &fields_19[38], &fields_19[39], &fields_19[40], &fields_19[41], &fields_19[42], &fields_19[43], &fields_19[44], &fields_19[45], &fields_19[46], &fields_19[47], &fields_19[48], NULL, NULL, &fields_19[49], &fields_19[50], &fields_19[51], &fields_19[52], &fields_19[53], &fields_19[54], &fields_19[55], &fields_19[56], &fields_19[57], &fields_19[58], &fields_19[59], NULL, NULL, &fields_19[60], &fields_19[61], &fields_19[62], &fields_19[63], &fields_19[64], &fields_19[65], &fields_19[66], &fields_19[67], &fields_19[68], &fields_19[69], &fields_19[70], NULL, NULL, &fields_19[71], &fields_19[72], &fields_19[73], &fields_19[74], &fields_19[75], &fields_19[76], &fields_19[77], &fields_19[78], &fields_19[79], &fields_19[80], NULL, NULL, &fields_19[81], &fields_19[82], NULL, &fields_19[83], NULL, NULL, NULL, NULL, NULL, &fields_19[84], &fields_19[85], &fields_19[86], &fields_19[87], &fields_19[88], &fields_19[89], &fields_19[90], &fields_19[91], NULL, &fields_19[92], NULL, &fields_19[93], NULL, &fields_19[94], &fields_19[95], NULL, &fields_19[96], NULL, NULL, NULL, NULL, NULL, &fields_19[97], &fields_19[98], &fields_19[99], &fields_19[100], &fields_19[101], &fields_19[102], &fields_19[103], &fields_19[104], &fields_19[105], &fields_19[106], &fields_19[107], &fields_19[108], &fields_19[109], &fields_19[110], &fields_19[111], &fields_19[112], &fields_19[113], &fields_19[114], NULL, NULL, NULL, NULL, NULL, &fields_19[115], &fields_19[116], &fields_19[117], NULL, NULL, &fields_19[118], &fields_19[119], &fields_19[120] };
+int16_t const names_19[] = { -1, 88, 15, 78, 70, -1, -1, 105, 17, 84, 104, 103, -1, -1, -1, 24, 72, -1, -1, 77, -1, -1, 46, -1, 25, 69, -1, -1, 14, 32, 21, -1, 31, -1, 93, 59, -1, -1, 5, 27, -1, -1, 110, -1, 68, -1, -1, -1, -1, 35, 7, -1, -1, 87, 86, 43, 102, 99, 36, 54, 81, 1, 3, -1, 12, 55, 52, -1, 112, 119, -1, -1, -1, 63, 76, 38, -1, -1, -1, 37, -1, -1, 62, 101, -1, -1, 30, 44, -1, 107, -1, -1, 56, -1, 118, -1, -1, -1, 61, -1, -1, -1, -1, 22, 109, 92, -1, -1, -1, -1, 47, 108, -1, -1, -1, -1, -1, -1, -1, 60, 117, -1, -1, 95, -1, 8, 97, -1, -1, 4, -1, -1, -1, 94, 40, -1, -1, 11, 113, 73, 71, 64, 57, -1, 50, -1, -1, 13, -1, -1, -1, 67, -1, 51, 29, 49, -1, -1, 34, -1, -1, -1, -1, -1, -1, -1, -1, 75, -1, 39, 98, -1, 79, -1, 120, 85, 58, 45, 65, 100, -1, 33, 90, -1, -1, -1, -1, 96, 0, 2, 114, -1, -1, 91, -1, 16, 41, -1, -1, -1, -1, -1, 116, -1, -1, -1, -1, -1, 10, -1, 18, -1, -1, -1, -1, 9, -1, 80, 106, 115, -1, -1, -1, 74, -1, -1, 48, -1, -1, 28, -1, -1, -1, -1, -1, 6, 20, 23, -1, 26, 111, -1, -1, 89, -1, -1, 42, 83, 66, -1, -1, 19, -1, 53, -1, 82 };
+uint32_t const disp_19[] = { 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 0, 7, 3, 5, 1, 1, 3, 1, 0, 1, 0, 4, 3, 0, 3, 1, 2, 1, 3, 2, 3, 1, 0, 2, 2, 1, 2, 3, 2, 0, 6, 2, 1, 1, 0, 1, 1, 1, 3, 0, 5, 0, 2, 2, 3, 0, 0, 5, 1, 1, 3, 1 };
+table const table_19 = { "term", fields_19, 121, by_index_19, 153, names_19, 255, disp_19, 63 };
 
-  "{\"signature\":\"LcfSaveData\",\"root\":[{\"type\":\"array1d\",\"name\":\"global\",\"value\":[{\"index\":100,\"type\":\"array1d\",\"name\":\"Preview\",\"value\":[{\"index\":1,\"type\":\"float\",\"name\":\"time_stamp\"},{\"index\":11,\"type\":\"string\",\"name\":\"name\"},{\"index\":12,\"type\":\"integer\",\"name\":\"level\",\"value\":1},{\"index\":13,\"type\":\"integer\",\"name\":\"hp\"},{\"index\":21,\"type\":\"string\",\"name\":\"face1\"},{\"index\":22,\"type\":\"integer\",\"name\":\"face_pos1\",\"value\":0},{\"index\":23,\"type\":\"string\",\"name\":\"face2\"},{\"index\":24,\"type\":\"integer\",\"name\":\"face_pos2\",\"value\":0},{\"index\":25,\"type\":\"string\",\"name\":\"face3\"},{\"index\":26,\"type\":\"integer\",\"name\":\"face_pos3\",\"value\":0},{\"index\":27,\"type\":\"string\",\"name\":\"face4\"},{\"index\":28,\"type\":\"integer\",\"name\":\"face_pos4\",\"value\":0}]},{\"index\":101,\"type\":\"array1d\",\"name\":\"system\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":11,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":21,\"type\":\"string\",\"name\":\"system\"},{\"index\":22,\"type\":\"integer\",\"name\":\"wallpaper\"},{\"index\":23,\"type\":\"integer\",\"name\":\"font\"},{\"index\":31,\"type\":\"integer\",\"name\":\"switch_count\",\"value\":0},{\"index\":32,\"type\":\"int8array\",\"name\":\"switch\"},{\"index\":33,\"type\":\"integer\",\"name\":\"variable_count\",\"value\":0},{\"index\":34,\"type\":\"int32array\",\"name\":\"variable\"},{\"index\":41,\"type\":\"integer\",\"name\":\"window_type\",\"value\":0},{\"index\":42,\"type\":\"integer\",\"name\":\"window_view_point\",\"value\":2},{\"index\":43,\"type\":\"bool\",\"name\":\"do_not_hide_party\",\"value\":true},{\"index\":44,\"type\":\"bool\",\"name\":\"move_when_wait\",\"value\":false},{\"index\":51,\"type\":\"string\",\"name\":\"face_set\"},{\"index\":52,\"type\":\"integer\",\"name\":\"face_set_pos\",\"value\":0},{\"index\":53,\"type\":\"integer\",\"name\":\"side\",\"value\":0},{\"index\":54,\"type\":\"bool\",\"name\":\"flip\",\"value\":false},{\"index\":55,\"type\":\"bool\",\"name\":\"party_transparent\",\"value\":false},{\"index\":71,\"type\":\"music\",\"name\":\"dummy\"},{\"index\":72,\"type\":\"music\",\"name\":\"battle\"},{\"index\":73,\"type\":\"music\",\"name\":\"battle_end\"},{\"index\":74,\"type\":\"music\",\"name\":\"hotel\"},{\"index\":75,\"type\":\"music\",\"name\":\"current\"},{\"index\":76,\"type\":\"music\",\"name\":\"dummy\"},{\"index\":77,\"type\":\"music\",\"name\":\"dummy\"},{\"index\":78,\"type\":\"music\",\"name\":\"memorized\"},{\"index\":79,\"type\":\"music\",\"name\":\"boat\"},{\"index\":80,\"type\":\"music\",\"name\":\"ship\"},{\"index\":81,\"type\":\"music\",\"name\":\"air_ship\"},{\"index\":82,\"type\":\"music\",\"name\":\"game_over\"},{\"index\":91,\"type\":\"sound\",\"name\":\"cursor_move\"},{\"index\":92,\"type\":\"sound\",\"name\":\"enter\"},{\"index\":93,\"type\":\"sound\",\"name\":\"cancel\"},{\"index\":94,\"type\":\"sound\",\"name\":\"buzzer\"},{\"index\":95,\"type\":\"sound\",\"name\":\"battle_start\"},{\"index\":96,\"type\":\"sound\",\"name\":\"run_away\"},{\"index\":97,\"type\":\"sound\",\"name\":\"enemy_attack\"},{\"index\":98,\"type\":\"sound\",\"name\":\"enemy_damaged\"},{\"index\":99,\"type\":\"sound\",\"name\":\"party_damaged\"},{\"index\":100,\"type\":\"sound\",\"name\":\"evasion\"},{\"index\":101,\"type\":\"sound\",\"name\":\"enamy_dead\"},{\"index\":102,\"type\":\"sound\",\"name\":\"item_use\"},{\"index\":111,\"type\":\"integer\",\"name\":\"move_erase\"},{\"index\":112,\"type\":\"integer\",\"name\":\"move_show\"},{\"index\":113,\"type\":\"integer\",\"name\":\"battle_start_srase\"},{\"index\":114,\"type\":\"integer\",\"name\":\"battle_start_show\"},{\"index\":115,\"type\":\"integer\",\"name\":\"battle_end_erase\"},{\"index\":116,\"type\":\"integer\",\"name\":\"battle_end_show\"},{\"index\":121,\"type\":\"bool\",\"name\":\"can_teleport\"},{\"index\":122,\"type\":\"bool\",\"name\":\"can_escape\"},{\"index\":123,\"type\":\"bool\",\"name\":\"can_save\"},{\"index\":124,\"type\":\"bool\",\"name\":\"can_open_menu\"},{\"index\":125,\"type\":\"string\",\"name\":\"backdrop\"},{\"index\":131,\"type\":\"integer\",\"name\":\"save_count\"},{\"index\":132,\"type\":\"integer\",\"name\":\"save_id\"}]},{\"index\":102,\"type\":\"array1d\",\"name\":\"screen\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"tint_finish_red\"},{\"index\":2,\"type\":\"integer\",\"name\":\"tint_finish_green\"},{\"index\":3,\"type\":\"integer\",\"name\":\"tint_finish_blue\"},{\"index\":4,\"type\":\"integer\",\"name\":\"tint_finish_sat\"},{\"index\":11,\"type\":\"float\",\"name\":\"tint_current_red\"},{\"index\":12,\"type\":\"float\",\"name\":\"tint_current_green\"},{\"index\":13,\"type\":\"float\",\"name\":\"tint_current_blue\"},{\"index\":14,\"type\":\"float\",\"name\":\"tint_current_sat\"},{\"index\":15,\"type\":\"integer\",\"name\":\"tint_time_left\",\"value\":0},{\"index\":20,\"type\":\"integer\",\"name\":\"flash_continuous\"},{\"index\":21,\"type\":\"integer\",\"name\":\"flash_red\"},{\"index\":22,\"type\":\"integer\",\"name\":\"flash_green\"},{\"index\":23,\"type\":\"integer\",\"name\":\"flash_blue\"},{\"index\":24,\"type\":\"integer\",\"name\":\"flash_current_level\"},{\"index\":25,\"type\":\"integer\",\"name\":\"flash_time_left\"},{\"index\":31,\"type\":\"integer\",\"name\":\"shacke_continuous\"},{\"index\":32,\"type\":\"integer\",\"name\":\"shacke_strength\"},{\"index\":33,\"type\":\"integer\",\"name\":\"shacke_speed\"},{\"index\":34,\"type\":\"integer\",\"name\":\"shacke_position\"},{\"index\":35,\"type\":\"integer\",\"name\":\"shacke_time_left\"},{\"index\":41,\"type\":\"integer\",\"name\":\"pan_x\"},{\"index\":42,\"type\":\"integer\",\"name\":\"pan_y\"},{\"index\":43,\"type\":\"integer\",\"name\":\"animation_id\"},{\"index\":44,\"type\":\"integer\",\"name\":\"animation_target\"},{\"index\":45,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":46,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":47,\"type\":\"integer\",\"name\":\"animation_global\"},{\"index\":48,\"type\":\"integer\",\"name\":\"weather\"},{\"index\":49,\"type\":\"integer\",\"name\":\"weather_strength\"}]},{\"index\":103,\"type\":\"array2d\",\"name\":\"picture\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"picture\"},{\"index\":2,\"type\":\"float\",\"name\":\"start_x\",\"value\":160},{\"index\":3,\"type\":\"float\",\"name\":\"start_y\",\"value\":120},{\"index\":4,\"type\":\"float\",\"name\":\"current_x\",\"value\":160},{\"index\":5,\"type\":\"float\",\"name\":\"current_y\",\"value\":120},{\"index\":6,\"type\":\"bool\",\"name\":\"picture_scrolls\",\"value\":false},{\"index\":8,\"type\":\"float\",\"name\":\"dummy\"},{\"index\":7,\"type\":\"float\",\"name\":\"current_maginify\"},{\"index\":8,\"type\":\"float\",\"name\":\"current_top_trans\"},{\"index\":9,\"type\":\"bool\",\"name\":\"transparency\",\"value\":false},{\"index\":11,\"type\":\"float\",\"name\":\"current_red\"},{\"index\":12,\"type\":\"float\",\"name\":\"current_green\"},{\"index\":13,\"type\":\"float\",\"name\":\"current_blue\"},{\"index\":14,\"type\":\"float\",\"name\":\"current_sat\"},{\"index\":15,\"type\":\"integer\",\"name\":\"effect_mode\"},{\"index\":16,\"type\":\"float\",\"name\":\"effect_speed\"},{\"index\":18,\"type\":\"float\",\"name\":\"current_bot_trans\"},{\"index\":31,\"type\":\"float\",\"name\":\"finish_x\"},{\"index\":32,\"type\":\"float\",\"name\":\"finish_y\"},{\"index\":33,\"type\":\"integer\",\"name\":\"finish_magnify\",\"value\":100},{\"index\":34,\"type\":\"integer\",\"name\":\"finish_top_trans\",\"value\":0},{\"index\":35,\"type\":\"integer\",\"name\":\"finish_bot_trans\",\"value\":0},{\"index\":41,\"type\":\"integer\",\"name\":\"finish_red\",\"value\":100},{\"index\":42,\"type\":\"integer\",\"name\":\"finish_green\",\"value\":100},{\"index\":43,\"type\":\"integer\",\"name\":\"finish_blue\",\"value\":100},{\"index\":44,\"type\":\"integer\",\"name\":\"finish_sat\",\"value\":100},{\"index\":46,\"type\":\"integer\",\"name\":\"effect2_speed\"},{\"index\":51,\"type\":\"integer\",\"name\":\"time_left\",\"value\":0},{\"index\":52,\"type\":\"float\",\"name\":\"current_rotation\"},{\"index\":53,\"type\":\"integer\",\"name\":\"current_waver\"}]},{\"index\":104,\"type\":\"event_state\",\"name\":\"party\"},{\"index\":105,\"type\":\"event_state\",\"name\":\"boat\"},{\"index\":106,\"type\":\"event_state\",\"name\":\"ship\"},{\"index\":107,\"type\":\"event_state\",\"name\":\"Airship\"},{\"index\":108,\"type\":\"array2d\",\"name\":\"actor\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\"},{\"index\":2,\"type\":\"string\",\"name\":\"title\"},{\"index\":3,\"type\":\"bool\",\"name\":\"semi_trans\"},{\"index\":11,\"type\":\"string\",\"name\":\"char_set\"},{\"index\":12,\"type\":\"integer\",\"name\":\"char_set_pos\"},{\"index\":13,\"type\":\"bool\",\"name\":\"trans\"},{\"index\":21,\"type\":\"string\",\"name\":\"face_set\"},{\"index\":22,\"type\":\"integer\",\"name\":\"face_set_pos\"},{\"index\":31,\"type\":\"integer\",\"name\":\"level\"},{\"index\":32,\"type\":\"integer\",\"name\":\"exp\"},{\"index\":33,\"type\":\"integer\",\"name\":\"hp_max\"},{\"index\":34,\"type\":\"integer\",\"name\":\"mp_max\"},{\"index\":41,\"type\":\"integer\",\"name\":\"attack\",\"value\":0},{\"index\":42,\"type\":\"integer\",\"name\":\"gaurd\",\"value\":0},{\"index\":43,\"type\":\"integer\",\"name\":\"mind\",\"value\":0},{\"index\":44,\"type\":\"integer\",\"name\":\"speed\",\"value\":0},{\"index\":51,\"type\":\"integer\",\"name\":\"skill_len\",\"value\":0},{\"index\":52,\"type\":\"int16array\",\"name\":\"skill\"},{\"index\":61,\"type\":\"int16array\",\"name\":\"equipment\"},{\"index\":71,\"type\":\"integer\",\"name\":\"cur_hp\",\"value\":0},{\"index\":72,\"type\":\"integer\",\"name\":\"cur_mp\",\"value\":0},{\"index\":81,\"type\":\"integer\",\"name\":\"condition_step_num\",\"value\":0},{\"index\":82,\"type\":\"int16array\",\"name\":\"condition_step\"},{\"index\":83,\"type\":\"integer\",\"name\":\"condition_num\",\"value\":0},{\"index\":84,\"type\":\"int8array\",\"name\":\"condition\"},{\"index\":90,\"type\":\"integer\",\"name\":\"job\"},{\"index\":91,\"type\":\"bool\",\"name\":\"double_hand\"}]},{\"index\":109,\"type\":\"array1d\",\"name\":\"inventory\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"member\",\"value\":0},{\"index\":2,\"type\":\"int16array\",\"name\":\"member\"},{\"index\":11,\"type\":\"integer\",\"name\":\"item_type_num\",\"value\":0},{\"index\":12,\"type\":\"int16array\",\"name\":\"item_id\"},{\"index\":13,\"type\":\"int8array\",\"name\":\"item_num\"},{\"index\":14,\"type\":\"int8array\",\"name\":\"item_use\"},{\"index\":21,\"type\":\"integer\",\"name\":\"money\",\"value\":0},{\"index\":23,\"type\":\"integer\",\"name\":\"timer1_secs\"},{\"index\":24,\"type\":\"bool\",\"name\":\"timer1_active\"},{\"index\":25,\"type\":\"bool\",\"name\":\"timer1_visible\"},{\"index\":26,\"type\":\"bool\",\"name\":\"timer1_battle\"},{\"index\":27,\"type\":\"integer\",\"name\":\"timer2_secs\"},{\"index\":28,\"type\":\"bool\",\"name\":\"timer2_active\"},{\"index\":29,\"type\":\"bool\",\"name\":\"timer2_visible\"},{\"index\":30,\"type\":\"bool\",\"name\":\"timer2_battle\"},{\"index\":32,\"type\":\"integer\",\"name\":\"battle\",\"value\":0},{\"index\":33,\"type\":\"integer\",\"name\":\"loss\",\"value\":0},{\"index\":34,\"type\":\"integer\",\"name\":\"win\",\"value\":0},{\"index\":35,\"type\":\"integer\",\"name\":\"escape\",\"value\":0},{\"index\":41,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":42,\"type\":\"int8array\",\"name\":\"dummy\"}]},{\"index\":110,\"type\":\"array2d\",\"name\":\"teleport\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"map_id\",\"value\":0},{\"index\":2,\"type\":\"integer\",\"name\":\"x\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"y\",\"value\":0},{\"index\":4,\"type\":\"bool\",\"name\":\"on_after_teleport\",\"value\":false},{\"index\":5,\"type\":\"integer\",\"name\":\"switch_id\",\"value\":1}]},{\"index\":111,\"type\":\"array1d\",\"name\":\"event_data\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":3,\"type\":\"integer\",\"name\":\"encount_rate\"},{\"index\":5,\"type\":\"integer\",\"name\":\"chip_set_id\"},{\"index\":11,\"type\":\"array2d\",\"name\":\"info\",\"value\":\"event_state\"},{\"index\":21,\"type\":\"int16array\",\"name\":\"lower\"},{\"index\":22,\"type\":\"int16array\",\"name\":\"upper\"},{\"index\":31,\"type\":\"bool\",\"name\":\"use_panorama\"},{\"index\":32,\"type\":\"string\",\"name\":\"panorama\"},{\"index\":33,\"type\":\"bool\",\"name\":\"horizontal_scroll\"},{\"index\":34,\"type\":\"bool\",\"name\":\"vertical_scroll\"},{\"index\":35,\"type\":\"bool\",\"name\":\"horizontal_scroll_auto\"},{\"index\":36,\"type\":\"integer\",\"name\":\"horizontal_scroll_speed\"},{\"index\":37,\"type\":\"bool\",\"name\":\"vertical_scroll_auto\"},{\"index\":38,\"type\":\"integer\",\"name\":\"vertical_scroll_speed\"}]},{\"index\":112,\"type\":\"array1d\",\"name\":\"dummy\",\"value\":[]},{\"index\":113,\"type\":\"array1d\",\"name\":\"dummy\",\"value\":[{\"index\":1,\"type\":\"array2d\",\"name\":\"dummy\",\"value\":[{\"index\":1,\"type\":\"integer\",\"name\":\"event_length\"},{\"index\":2,\"type\":\"event\",\"name\":\"dummy\"},{\"index\":11,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":12,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":13,\"type\":\"event\",\"name\":\"dummy\"},{\"index\":21,\"type\":\"integer\",\"name\":\"dummy\"},{\"index\":22,\"type\":\"integer\",\"name\":\"dummy\"}]},{\"index\":4,\"type\":\"integer\",\"name\":\"dummy\"}]},{\"index\":114,\"type\":\"array2d\",\"name\":\"dummy\",\"value\":[{\"index\":1,\"type\":\"array1d\",\"name\":\"dummy\",\"value\":[{\"index\":1,\"type\":\"int8array\",\"name\":\"dummy\"}]}]}]}]}",
+field const fields_20[] = {
+  { 1, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 2, "fade_in_time", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "volume", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 4, "tempo", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 5, "balance", LCF::schema::integer, NULL, true, 50, 0.0, NULL },
+};
+field const* const by_index_20[] = { NULL, &fields_20[0], &fields_20[1], &fields_20[2], &fields_20[3], &fields_20[4] };
+int16_t const names_20[] = { -1, -1, -1, -1, 2, -1, -1, -1, 1, 0, 3, -1, -1, -1, 4, -1 };
+uint32_t const disp_20[] = { 0, 0, 1, 1 };
+table const table_20 = { "music", fields_20, 5, by_index_20, 5, names_20, 15, disp_20, 3 };
+
+field const fields_21[] = {
+  { 1, "actor_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 2, "level", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 11, "weapon", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "shield", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 13, "armor", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 14, "helmet", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 15, "accessory", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_21[] = { NULL, &fields_21[0], &fields_21[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_21[2], &fields_21[3], &fields_21[4], &fields_21[5], &fields_21[6] };
+int16_t const names_21[] = { 3, -1, 6, -1, 0, -1, 4, -1, -1, -1, 5, -1, -1, -1, 1, 2 };
+uint32_t const disp_21[] = { 2, 1, 1, 1 };
+table const table_21 = { "test_battle", fields_21, 7, by_index_21, 15, names_21, 15, disp_21, 3 };
+
+field const fields_22[] = {
+  { 10, "version", LCF::schema::integer, NULL, true, 2000, 0.0, NULL },
+  { 11, "boat", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 12, "ship", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 13, "airship", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 14, "boat_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 15, "ship_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 16, "airship_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 17, "title", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 18, "game_over", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 19, "system", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 20, "system_2", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 21, "member_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 22, "member", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 26, "menu_command_size", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 27, "menu_command", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 31, "title_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 32, "battle_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 33, "battle_end_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 34, "inn_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 35, "boat_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 36, "ship_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 37, "airship_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 38, "game_over_music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 41, "cursor_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 42, "decision_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 43, "cancel_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 44, "buzzer_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 45, "battle_start_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 46, "escape_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 47, "enemy_attack_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 48, "enemy_damaged_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 49, "member_damaged_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 50, "evasion_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 51, "enemy_defeat_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 52, "use_item_se", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 61, "transition_out", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 62, "transition_in", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 63, "battle_start_erace", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 64, "battle_start_display", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 65, "battle_end_erace", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 66, "battle_end_display", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 71, "wallpaper", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 72, "font", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 81, "test_condition", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 82, "selected_character", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 83, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 84, "default_backdrop", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 85, "test_battle", LCF::schema::array2d, &table_21, false, 0, 0.0, NULL },
+  { 91, "save_time", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_22[] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_22[0], &fields_22[1], &fields_22[2], &fields_22[3], &fields_22[4], &fields_22[5], &fields_22[6], &fields_22[7], &fields_22[8], &fields_22[9], &fields_22[10], &fields_22[11], &fields_22[12], NULL, NULL, NULL, &fields_22[13], &fields_22[14], NULL, NULL, NULL, &fields_22[15], &fields_22[16], &fields_22[17], &fields_22[18], &fields_22[19], &fields_22[20], &fields_22[21], &fields_22[22], NULL, NULL, &fields_22[23], &fields_22[24], &fields_22[25], &fields_22[26], &fields_22[27], &fields_22[28], &fields_22[29], &fields_22[30], &fields_22[31], &fields_22[32], &fields_22[33], &fields_22[34], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_22[35], &fields_22[36], &fields_22[37], &fields_22[38], &fields_22[39], &fields_22[40], NULL, NULL, NULL, NULL, &fields_22[41], &fields_22[42], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_22[43], &fields_22[44], &fields_22[45], &fields_22[46], &fields_22[47], NULL, NULL, NULL, NULL, NULL, &fields_22[48] };
+int16_t const names_22[] = { -1, -1, -1, -1, -1, -1, -1, -1, 6, 31, -1, 13, 11, 26, 39, -1, -1, -1, 27, 37, -1, 32, 8, 24, -1, -1, -1, 20, 36, 48, -1, -1, -1, -1, 35, -1, 42, 4, -1, -1, -1, -1, -1, -1, 19, 0, -1, -1, 44, -1, -1, 33, -1, -1, -1, 14, -1, 21, -1, -1, 23, -1, 12, -1, -1, 3, -1, -1, -1, -1, -1, 7, 40, -1, -1, -1, 15, -1, 34, 25, 47, -1, -1, 29, 10, -1, 16, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, 30, -1, 2, 41, -1, 43, 38, -1, 17, 46, 28, -1, -1, -1, 5, 22, -1, -1, -1, 9, -1, -1, -1, -1, 45, -1, -1, 18, -1, -1, -1 };
+uint32_t const disp_22[] = { 1, 1, 0, 1, 0, 1, 1, 0, 1, 1, 0, 2, 5, 4, 0, 1, 1, 2, 0, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 2, 1 };
+table const table_22 = { "system", fields_22, 49, by_index_22, 91, names_22, 127, disp_22, 31 };
+
+field const fields_23[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+};
+field const* const by_index_23[] = { NULL, &fields_23[0] };
+int16_t const names_23[] = { -1, 0 };
+uint32_t const disp_23[] = { 1 };
+table const table_23 = { "switch", fields_23, 1, by_index_23, 1, names_23, 1, disp_23, 0 };
+
+field const fields_24[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+};
+field const* const by_index_24[] = { NULL, &fields_24[0] };
+int16_t const names_24[] = { -1, 0 };
+uint32_t const disp_24[] = { 1 };
+table const table_24 = { "variable", fields_24, 1, by_index_24, 1, names_24, 1, disp_24, 0 };
+
+field const fields_25[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 11, "start_type", LCF::schema::integer, NULL, true, 5, 0.0, NULL },
+  { 12, "need_switch", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 13, "switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 21, "event_length", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 22, "event", LCF::schema::event, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_25[] = { NULL, &fields_25[0], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_25[1], &fields_25[2], &fields_25[3], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_25[4], &fields_25[5] };
+int16_t const names_25[] = { 3, -1, -1, -1, 5, -1, 0, 2, -1, -1, -1, -1, -1, -1, 1, 4 };
+uint32_t const disp_25[] = { 1, 1, 3, 0 };
+table const table_25 = { "common_event", fields_25, 6, by_index_25, 22, names_25, 15, disp_25, 3 };
+
+field const fields_26[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_26[] = { NULL, &fields_26[0], &fields_26[1] };
+int16_t const names_26[] = { -1, 0, 1, -1 };
+uint32_t const disp_26[] = { 1 };
+table const table_26 = { "battle_command", fields_26, 2, by_index_26, 2, names_26, 3, disp_26, 0 };
+
+field const fields_27[] = {
+  { 1, "level", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 2, "skill_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+};
+field const* const by_index_27[] = { NULL, &fields_27[0], &fields_27[1] };
+int16_t const names_27[] = { 1, -1, 0, -1 };
+uint32_t const disp_27[] = { 2 };
+table const table_27 = { "skill", fields_27, 2, by_index_27, 2, names_27, 3, disp_27, 0 };
+
+field const fields_28[] = {
+  { 1, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 21, "double_hand", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 22, "fixed_equipment", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 23, "forced_ai_action", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 24, "strong_defence", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 31, "parameter", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 41, "exp_base", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 42, "exp_inflation", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 43, "exp_correction", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 51, "equipment", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 56, "unarmed_attack", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 62, "attack_anime", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 63, "skill", LCF::schema::array2d, &table_27, false, 0, 0.0, NULL },
+  { 66, "use_original_command", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 67, "original_command", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 71, "condition_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 72, "condition_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 73, "attrib_data_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 74, "attrib_data", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 80, "battle_command", LCF::schema::int32array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_28[] = { NULL, &fields_28[0], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_28[1], &fields_28[2], &fields_28[3], &fields_28[4], NULL, NULL, NULL, NULL, NULL, NULL, &fields_28[5], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_28[6], &fields_28[7], &fields_28[8], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_28[9], NULL, NULL, NULL, NULL, &fields_28[10], NULL, NULL, NULL, NULL, NULL, &fields_28[11], &fields_28[12], NULL, NULL, &fields_28[13], &fields_28[14], NULL, NULL, NULL, &fields_28[15], &fields_28[16], &fields_28[17], &fields_28[18], NULL, NULL, NULL, NULL, NULL, &fields_28[19] };
+int16_t const names_28[] = { -1, -1, 6, -1, -1, -1, -1, -1, 16, 0, -1, 8, -1, -1, -1, -1, -1, -1, 2, 17, -1, 4, -1, -1, 3, -1, 19, -1, 15, -1, -1, 12, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, 18, -1, -1, 11, -1, -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, 10, 5, -1, 13, 9, 7, -1 };
+uint32_t const disp_28[] = { 0, 1, 2, 1, 2, 2, 1, 0, 1, 0, 0, 2, 1, 1, 2, 1 };
+table const table_28 = { "class", fields_28, 20, by_index_28, 80, names_28, 63, disp_28, 15 };
+
+field const fields_29[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "battle", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "battle_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 4, "use_extended_animation", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 5, "extended_animation_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_29[] = { NULL, &fields_29[0], &fields_29[1], &fields_29[2], &fields_29[3], &fields_29[4] };
+int16_t const names_29[] = { -1, -1, -1, -1, -1, 4, -1, 1, 3, 0, -1, -1, -1, 2, -1, -1 };
+uint32_t const disp_29[] = { 0, 1, 1, 2 };
+table const table_29 = { "basic", fields_29, 5, by_index_29, 5, names_29, 15, disp_29, 3 };
+
+field const fields_30[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "file", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "index", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 4, "use_extended_animation", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 5, "extended_animation_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_30[] = { NULL, &fields_30[0], &fields_30[1], &fields_30[2], &fields_30[3], &fields_30[4] };
+int16_t const names_30[] = { -1, 1, -1, -1, -1, 4, -1, -1, 3, 0, -1, -1, -1, -1, -1, 2 };
+uint32_t const disp_30[] = { 0, 1, 1, 0 };
+table const table_30 = { "weapon", fields_30, 5, by_index_30, 5, names_30, 15, disp_30, 3 };
 
-  "{\"type\":\"array1d\",\"name\":\"music\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\"},{\"index\":2,\"type\":\"integer\",\"name\":\"fade_in_time\",\"value\":0},{\"index\":3,\"type\":\"integer\",\"name\":\"volume\",\"value\":100},{\"index\":4,\"type\":\"integer\",\"name\":\"tempo\",\"value\":100},{\"index\":5,\"type\":\"integer\",\"name\":\"balance\",\"value\":50}]}",
+field const fields_31[] = {
+  { 1, "name", LCF::schema::string, NULL, true, 0, 0.0, "" },
+  { 2, "attack_motion", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 11, "basic", LCF::schema::array2d, &table_29, false, 0, 0.0, NULL },
+  { 12, "weapon", LCF::schema::array2d, &table_30, false, 0, 0.0, NULL },
+};
+field const* const by_index_31[] = { NULL, &fields_31[0], &fields_31[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_31[2], &fields_31[3] };
+int16_t const names_31[] = { -1, 1, -1, 3, 2, -1, 0, -1 };
+uint32_t const disp_31[] = { 2, 2 };
+table const table_31 = { "battle_anime2", fields_31, 4, by_index_31, 12, names_31, 7, disp_31, 1 };
+
+field const fields_32[] = {
+  { 11, "actor", LCF::schema::array2d, &table_1, false, 0, 0.0, NULL },
+  { 12, "skill", LCF::schema::array2d, &table_3, false, 0, 0.0, NULL },
+  { 13, "item", LCF::schema::array2d, &table_4, false, 0, 0.0, NULL },
+  { 14, "enemy", LCF::schema::array2d, &table_6, false, 0, 0.0, NULL },
+  { 15, "enemy_group", LCF::schema::array2d, &table_10, false, 0, 0.0, NULL },
+  { 16, "terrain", LCF::schema::array2d, &table_11, false, 0, 0.0, NULL },
+  { 17, "attribute", LCF::schema::array2d, &table_12, false, 0, 0.0, NULL },
+  { 18, "condition", LCF::schema::array2d, &table_13, false, 0, 0.0, NULL },
+  { 19, "animation", LCF::schema::array2d, &table_17, false, 0, 0.0, NULL },
+  { 20, "chipset", LCF::schema::array2d, &table_18, false, 0, 0.0, NULL },
+  { 21, "term", LCF::schema::array1d, &table_19, false, 0, 0.0, NULL },
+  { 22, "system", LCF::schema::array1d, &table_22, false, 0, 0.0, NULL },
+  { 23, "switch", LCF::schema::array2d, &table_23, false, 0, 0.0, NULL },
+  { 24, "variable", LCF::schema::array2d, &table_24, false, 0, 0.0, NULL },
+  { 25, "common_event", LCF::schema::array2d, &table_25, false, 0, 0.0, NULL },
+  { 26, "common_event_2", LCF::schema::array2d, &table_25, false, 0, 0.0, NULL },
+  { 27, "common_event_3", LCF::schema::array2d, &table_25, false, 0, 0.0, NULL },
+  { 28, "common_event_4", LCF::schema::array2d, &table_25, false, 0, 0.0, NULL },
+  { 29, "battle_command", LCF::schema::array2d, &table_26, false, 0, 0.0, NULL },
+  { 30, "class_1", LCF::schema::array2d, &table_28, false, 0, 0.0, NULL },
+  { 31, "class_2", LCF::schema::array2d, &table_28, false, 0, 0.0, NULL },
+  { 32, "battle_anime2", LCF::schema::array2d, &table_31, false, 0, 0.0, NULL },
+};
+field const* const by_index_32[] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_32[0], &fields_32[1], &fields_32[2], &fields_32[3], &fields_32[4], &fields_32[5], &fields_32[6], &fields_32[7], &fields_32[8], &fields_32[9], &fields_32[10], &fields_32[11], &fields_32[12], &fields_32[13], &fields_32[14], &fields_32[15], &fields_32[16], &fields_32[17], &fields_32[18], &fields_32[19], &fields_32[20], &fields_32[21] };
+int16_t const names_32[] = { 5, 3, -1, 19, -1, -1, -1, 6, 14, -1, -1, -1, -1, -1, -1, -1, 13, 12, 1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1, 8, 10, 0, -1, -1, 18, -1, -1, -1, -1, -1, -1, -1, 16, -1, 4, -1, 17, -1, -1, 9, -1, -1, 11, -1, -1, 20, 2, -1, 7, -1, 21, -1, -1, -1 };
+uint32_t const disp_32[] = { 1, 1, 1, 0, 2, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+table const table_32 = { "global", fields_32, 22, by_index_32, 32, names_32, 63, disp_32, 15 };
+
+field const fields_33[] = {
+  { 1, "enemy_group_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_33[] = { NULL, &fields_33[0] };
+int16_t const names_33[] = { -1, 0 };
+uint32_t const disp_33[] = { 1 };
+table const table_33 = { "encount", fields_33, 1, by_index_33, 1, names_33, 1, disp_33, 0 };
+
+field const fields_34[] = {
+  { 1, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 2, "parent", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "indentation", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 4, "type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 5, "scrollbar_x", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 6, "scrollbar_y", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 7, "expanded", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 11, "music_type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 12, "music", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 21, "backdrop_type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 22, "backdrop", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 31, "teleport", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 32, "escape", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 33, "save", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 41, "encount", LCF::schema::array2d, &table_33, false, 0, 0.0, NULL },
+  { 44, "encounter_steps", LCF::schema::integer, NULL, true, 25, 0.0, NULL },
+  { 51, "area_range", LCF::schema::int32array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_34[] = { NULL, &fields_34[0], &fields_34[1], &fields_34[2], &fields_34[3], &fields_34[4], &fields_34[5], &fields_34[6], NULL, NULL, NULL, &fields_34[7], &fields_34[8], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_34[9], &fields_34[10], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_34[11], &fields_34[12], &fields_34[13], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_34[14], NULL, NULL, &fields_34[15], NULL, NULL, NULL, NULL, NULL, NULL, &fields_34[16] };
+int16_t const names_34[] = { 2, -1, 3, -1, -1, -1, 0, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, 11, -1, -1, -1, 15, -1, 16, 13, 6, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, -1, 9, 10, -1, -1, -1, -1, -1, 7, 12, -1, -1, 1, -1, -1, -1, -1, 5, -1 };
+uint32_t const disp_34[] = { 1, 3, 0, 1, 0, 1, 3, 0, 1, 1, 0, 1, 1, 1, 0, 0 };
+table const table_34 = { "global", fields_34, 17, by_index_34, 51, names_34, 63, disp_34, 15 };
+
+field const fields_35[] = {
+  { 1, "party_map_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 2, "party_x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "party_y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 11, "boat_map_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "boat_x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 13, "boat_y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 21, "ship_map_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 22, "ship_x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 23, "ship_y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 31, "airship_map_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 32, "airship_x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 33, "airship_y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_35[] = { NULL, &fields_35[0], &fields_35[1], &fields_35[2], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_35[3], &fields_35[4], &fields_35[5], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_35[6], &fields_35[7], &fields_35[8], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_35[9], &fields_35[10], &fields_35[11] };
+int16_t const names_35[] = { -1, 9, 6, 0, -1, -1, -1, -1, -1, 5, -1, 11, -1, -1, -1, 4, 1, 8, 3, -1, 7, -1, -1, 2, -1, -1, -1, -1, -1, -1, 10, -1 };
+uint32_t const disp_35[] = { 1, 1, 2, 3, 2, 3, 1, 0 };
+table const table_35 = { "start_point", fields_35, 12, by_index_35, 33, names_35, 31, disp_35, 7 };
+
+field const fields_36[] = {
+  { 1, "flags", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 2, "switch_id1", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 3, "switch_id2", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 4, "variable_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 5, "variable_value", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 6, "item_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 7, "char_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 8, "timer_left_1", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 9, "timer_left_2", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 10, "compare_operator", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_36[] = { NULL, &fields_36[0], &fields_36[1], &fields_36[2], &fields_36[3], &fields_36[4], &fields_36[5], &fields_36[6], &fields_36[7], &fields_36[8], &fields_36[9] };
+int16_t const names_36[] = { 4, -1, -1, -1, -1, 0, 5, -1, -1, 1, -1, -1, -1, -1, -1, 6, 3, -1, -1, -1, -1, -1, 9, -1, -1, -1, 8, 2, 7, -1, -1, -1 };
+uint32_t const disp_36[] = { 1, 1, 1, 0, 1, 1, 3, 0 };
+table const table_36 = { "term", fields_36, 10, by_index_36, 10, names_36, 31, disp_36, 7 };
+
+field const fields_37[] = {
+  { 11, "length", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "data", LCF::schema::ber_array, NULL, false, 0, 0.0, NULL },
+  { 21, "repeat", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 22, "skippable", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_37[] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_37[0], &fields_37[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_37[2], &fields_37[3] };
+int16_t const names_37[] = { -1, -1, 0, 2, -1, -1, 3, 1 };
+uint32_t const disp_37[] = { 1, 1 };
+table const table_37 = { "move", fields_37, 4, by_index_37, 22, names_37, 7, disp_37, 1 };
+
+field const fields_38[] = {
+  { 2, "term", LCF::schema::array1d, &table_36, false, 0, 0.0, NULL },
+  { 21, "charset", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 22, "charset_pos", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 23, "charset_dir", LCF::schema::integer, NULL, true, 2, 0.0, NULL },
+  { 24, "charset_pat", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 25, "semi_trans", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 31, "action", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 32, "frequency", LCF::schema::integer, NULL, true, 3, 0.0, NULL },
+  { 33, "trigger", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 34, "priority_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 35, "no_pile", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 36, "anime_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 37, "speed", LCF::schema::integer, NULL, true, 3, 0.0, NULL },
+  { 41, "move", LCF::schema::array1d, &table_37, false, 0, 0.0, NULL },
+  { 51, "event_length", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 52, "event", LCF::schema::event, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_38[] = { NULL, NULL, &fields_38[0], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_38[1], &fields_38[2], &fields_38[3], &fields_38[4], &fields_38[5], NULL, NULL, NULL, NULL, NULL, &fields_38[6], &fields_38[7], &fields_38[8], &fields_38[9], &fields_38[10], &fields_38[11], &fields_38[12], NULL, NULL, NULL, &fields_38[13], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_38[14], &fields_38[15] };
+int16_t const names_38[] = { -1, 12, -1, 9, 15, 1, -1, -1, 5, -1, -1, 2, -1, -1, -1, -1, -1, 6, -1, -1, -1, 14, -1, 8, 7, 10, -1, 13, 4, 3, 0, 11 };
+uint32_t const disp_38[] = { 2, 1, 1, 1, 1, 2, 1, 2 };
+table const table_38 = { "page", fields_38, 16, by_index_38, 52, names_38, 31, disp_38, 7 };
+
+field const fields_39[] = {
+  { 1, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 2, "x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 5, "page", LCF::schema::array2d, &table_38, false, 0, 0.0, NULL },
+};
+field const* const by_index_39[] = { NULL, &fields_39[0], &fields_39[1], &fields_39[2], NULL, &fields_39[3] };
+int16_t const names_39[] = { 3, -1, 0, -1, -1, 2, -1, 1 };
+uint32_t const disp_39[] = { 4, 4 };
+table const table_39 = { "event", fields_39, 4, by_index_39, 5, names_39, 7, disp_39, 1 };
+
+field const fields_40[] = {
+  { 1, "chipset_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 2, "width", LCF::schema::integer, NULL, true, 20, 0.0, NULL },
+  { 3, "height", LCF::schema::integer, NULL, true, 15, 0.0, NULL },
+  { 11, "scroll_type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 31, "use_panorama", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 32, "panorama_name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 33, "panorama_loop_x", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 34, "panorama_loop_y", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 35, "panorama_auto_loop_x", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 36, "panorama_sx", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 37, "panorama_auto_loop_y", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 38, "panorama_sy", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 71, "lower_layer", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 72, "upper_layer", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 81, "event", LCF::schema::array2d, &table_39, false, 0, 0.0, NULL },
+  { 91, "save_time", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_40[] = { NULL, &fields_40[0], &fields_40[1], &fields_40[2], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_40[3], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_40[4], &fields_40[5], &fields_40[6], &fields_40[7], &fields_40[8], &fields_40[9], &fields_40[10], &fields_40[11], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_40[12], &fields_40[13], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_40[14], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_40[15] };
+int16_t const names_40[] = { 5, 7, -1, 13, 14, 4, 2, -1, 12, -1, -1, -1, 8, -1, 3, -1, -1, -1, -1, 6, 9, 1, -1, -1, 11, 10, -1, 0, -1, 15, -1, -1 };
+uint32_t const disp_40[] = { 3, 1, 1, 2, 1, 2, 0, 1 };
+table const table_40 = { "global", fields_40, 16, by_index_40, 91, names_40, 31, disp_40, 7 };
+
+field const fields_41[] = {
+  { 1, "time_stamp", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 11, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 12, "level", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 13, "hp", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 21, "face1", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 22, "face_pos1", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 23, "face2", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 24, "face_pos2", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 25, "face3", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 26, "face_pos3", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 27, "face4", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 28, "face_pos4", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_41[] = { NULL, &fields_41[0], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_41[1], &fields_41[2], &fields_41[3], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_41[4], &fields_41[5], &fields_41[6], &fields_41[7], &fields_41[8], &fields_41[9], &fields_41[10], &fields_41[11] };
+int16_t const names_41[] = { 10, 3, 0, 11, -1, -1, -1, -1, -1, 5, -1, -1, -1, 9, -1, -1, -1, -1, 2, -1, 4, -1, -1, -1, 7, -1, 6, -1, 8, -1, 1, -1 };
+uint32_t const disp_41[] = { 1, 0, 1, 1, 1, 3, 2, 2 };
+table const table_41 = { "Preview", fields_41, 12, by_index_41, 28, names_41, 31, disp_41, 7 };
+
+field const fields_42[] = {
+  { 1, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 11, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 21, "system", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 22, "wallpaper", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 23, "font", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 31, "switch_count", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 32, "switch", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 33, "variable_count", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 34, "variable", LCF::schema::int32array, NULL, false, 0, 0.0, NULL },
+  { 41, "window_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 42, "window_view_point", LCF::schema::integer, NULL, true, 2, 0.0, NULL },
+  { 43, "do_not_hide_party", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 44, "move_when_wait", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 51, "face_set", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 52, "face_set_pos", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 53, "side", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 54, "flip", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 55, "party_transparent", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 71, "dummy", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 72, "battle", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 73, "battle_end", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 74, "hotel", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 75, "current", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 76, "dummy", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 77, "dummy", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 78, "memorized", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 79, "boat", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 80, "ship", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 81, "air_ship", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 82, "game_over", LCF::schema::array1d, &table_20, false, 0, 0.0, NULL },
+  { 91, "cursor_move", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 92, "enter", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 93, "cancel", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 94, "buzzer", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 95, "battle_start", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 96, "run_away", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 97, "enemy_attack", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 98, "enemy_damaged", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 99, "party_damaged", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 100, "evasion", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 101, "enamy_dead", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 102, "item_use", LCF::schema::array1d, &table_2, false, 0, 0.0, NULL },
+  { 111, "move_erase", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 112, "move_show", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 113, "battle_start_srase", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 114, "battle_start_show", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 115, "battle_end_erase", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 116, "battle_end_show", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 121, "can_teleport", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 122, "can_escape", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 123, "can_save", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 124, "can_open_menu", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 125, "backdrop", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 131, "save_count", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 132, "save_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_42[] = { NULL, &fields_42[0], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[2], &fields_42[3], &fields_42[4], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[5], &fields_42[6], &fields_42[7], &fields_42[8], NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[9], &fields_42[10], &fields_42[11], &fields_42[12], NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[13], &fields_42[14], &fields_42[15], &fields_42[16], &fields_42[17], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[18], &fields_42[19], &fields_42[20], &fields_42[21], &fields_42[22], &fields_42[23], &fields_42[24], &fields_42[25], &fields_42[26], &fields_42[27], &fields_42[28], &fields_42[29], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[30], &fields_42[31], &fields_42[32], &fields_42[33], &fields_42[34], &fields_42[35], &fields_42[36], &fields_42[37], &fields_42[38], &fields_42[39], &fields_42[40], &fields_42[41], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_42[42], &fields_42[43], &fields_42[44], &fields_42[45], &fields_42[46], &fields_42[47], NULL, NULL, NULL, NULL, &fields_42[48], &fields_42[49], &fields_42[50], &fields_42[51], &fields_42[52], NULL, NULL, NULL, NULL, NULL, &fields_42[53], &fields_42[54] };
+int16_t const names_42[] = { -1, -1, -1, -1, 13, -1, 7, 15, 35, 19, -1, -1, -1, -1, 26, -1, 38, 6, 9, 5, -1, -1, -1, -1, -1, -1, 34, 49, -1, -1, -1, 28, -1, -1, 10, -1, 31, 42, 46, 41, -1, 44, -1, 53, -1, 40, 45, -1, -1, 47, -1, -1, -1, 33, -1, 21, -1, -1, 4, 20, 16, 51, -1, 37, -1, -1, -1, 11, 8, -1, -1, 22, -1, -1, -1, -1, -1, 27, 17, -1, -1, -1, -1, -1, -1, -1, 50, 39, 36, -1, 30, 12, -1, -1, -1, -1, 52, -1, -1, -1, 3, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1, 48, -1, -1, -1, -1, 2, -1, 32, -1, -1, 0, 25, 43, 29, 54, -1, -1 };
+uint32_t const disp_42[] = { 1, 1, 1, 1, 0, 0, 0, 1, 2, 1, 1, 3, 1, 2, 2, 2, 1, 1, 1, 1, 2, 3, 1, 4, 2, 1, 1, 0, 0, 1, 1, 1 };
+table const table_42 = { "system", fields_42, 55, by_index_42, 132, names_42, 127, disp_42, 31 };
+
+field const fields_43[] = {
+  { 1, "tint_finish_red", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 2, "tint_finish_green", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 3, "tint_finish_blue", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 4, "tint_finish_sat", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 11, "tint_current_red", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 12, "tint_current_green", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 13, "tint_current_blue", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 14, "tint_current_sat", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 15, "tint_time_left", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 20, "flash_continuous", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 21, "flash_red", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 22, "flash_green", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 23, "flash_blue", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 24, "flash_current_level", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 25, "flash_time_left", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 31, "shacke_continuous", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 32, "shacke_strength", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 33, "shacke_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 34, "shacke_position", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 35, "shacke_time_left", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 41, "pan_x", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 42, "pan_y", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 43, "animation_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 44, "animation_target", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 45, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 46, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 47, "animation_global", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 48, "weather", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 49, "weather_strength", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_43[] = { NULL, &fields_43[0], &fields_43[1], &fields_43[2], &fields_43[3], NULL, NULL, NULL, NULL, NULL, NULL, &fields_43[4], &fields_43[5], &fields_43[6], &fields_43[7], &fields_43[8], NULL, NULL, NULL, NULL, &fields_43[9], &fields_43[10], &fields_43[11], &fields_43[12], &fields_43[13], &fields_43[14], NULL, NULL, NULL, NULL, NULL, &fields_43[15], &fields_43[16], &fields_43[17], &fields_43[18], &fields_43[19], NULL, NULL, NULL, NULL, NULL, &fields_43[20], &fields_43[21], &fields_43[22], &fields_43[23], &fields_43[24], &fields_43[25], &fields_43[26], &fields_43[27], &fields_43[28] };
+int16_t const names_43[] = { -1, -1, 6, 14, 12, -1, 0, -1, 27, -1, -1, 20, -1, -1, -1, -1, 3, -1, 21, -1, 1, 18, 7, -1, -1, 28, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, 26, 19, -1, 11, -1, 15, -1, -1, -1, -1, -1, 17, -1, 22, -1, 5, -1, 16, 4, 13, 9, 24, -1, 10, 23, -1, -1, 2 };
+uint32_t const disp_43[] = { 1, 3, 1, 1, 1, 2, 1, 2, 1, 2, 0, 1, 0, 1, 4, 1 };
+table const table_43 = { "screen", fields_43, 29, by_index_43, 49, names_43, 63, disp_43, 15 };
+
+field const fields_44[] = {
+  { 1, "picture", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 2, "start_x", LCF::schema::float_, NULL, true, 0, 160.0, NULL },
+  { 3, "start_y", LCF::schema::float_, NULL, true, 0, 120.0, NULL },
+  { 4, "current_x", LCF::schema::float_, NULL, true, 0, 160.0, NULL },
+  { 5, "current_y", LCF::schema::float_, NULL, true, 0, 120.0, NULL },
+  { 6, "picture_scrolls", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 7, "current_maginify", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 8, "dummy", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 8, "current_top_trans", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 9, "transparency", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 11, "current_red", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 12, "current_green", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 13, "current_blue", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 14, "current_sat", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 15, "effect_mode", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 16, "effect_speed", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 18, "current_bot_trans", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 31, "finish_x", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 32, "finish_y", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 33, "finish_magnify", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 34, "finish_top_trans", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 35, "finish_bot_trans", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 41, "finish_red", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 42, "finish_green", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 43, "finish_blue", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 44, "finish_sat", LCF::schema::integer, NULL, true, 100, 0.0, NULL },
+  { 46, "effect2_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 51, "time_left", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 52, "current_rotation", LCF::schema::float_, NULL, false, 0, 0.0, NULL },
+  { 53, "current_waver", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_44[] = { NULL, &fields_44[0], &fields_44[1], &fields_44[2], &fields_44[3], &fields_44[4], &fields_44[5], &fields_44[6], &fields_44[7], &fields_44[9], NULL, &fields_44[10], &fields_44[11], &fields_44[12], &fields_44[13], &fields_44[14], &fields_44[15], NULL, &fields_44[16], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_44[17], &fields_44[18], &fields_44[19], &fields_44[20], &fields_44[21], NULL, NULL, NULL, NULL, NULL, &fields_44[22], &fields_44[23], &fields_44[24], &fields_44[25], NULL, &fields_44[26], NULL, NULL, NULL, NULL, &fields_44[27], &fields_44[28], &fields_44[29] };
+int16_t const names_44[] = { -1, -1, 7, -1, 19, -1, 13, -1, 25, 23, -1, -1, 6, 21, 29, -1, -1, -1, 12, 11, -1, 22, -1, -1, 20, 1, -1, -1, -1, 14, -1, 17, 26, 27, -1, -1, 0, 28, -1, -1, -1, -1, -1, -1, 8, 16, -1, -1, 9, 3, -1, -1, 24, -1, -1, 4, -1, 10, 15, -1, 2, 18, 5, -1 };
+uint32_t const disp_44[] = { 2, 1, 1, 1, 0, 1, 2, 1, 2, 1, 0, 1, 2, 3, 3, 1 };
+table const table_44 = { "picture", fields_44, 30, by_index_44, 53, names_44, 63, disp_44, 15 };
+
+field const fields_45[] = {
+  { 11, "length", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "data", LCF::schema::ber_array, NULL, false, 0, 0.0, NULL },
+  { 21, "repeat", LCF::schema::bool_, NULL, true, 1, 0.0, NULL },
+  { 22, "pass", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+};
+field const* const by_index_45[] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_45[0], &fields_45[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_45[2], &fields_45[3] };
+int16_t const names_45[] = { 2, -1, 1, -1, 0, -1, 3, -1 };
+uint32_t const disp_45[] = { 2, 0 };
+table const table_45 = { "move", fields_45, 4, by_index_45, 22, names_45, 7, disp_45, 1 };
+
+field const fields_46[] = {
+  { 1, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_46[] = { NULL, &fields_46[0] };
+int16_t const names_46[] = { -1, 0 };
+uint32_t const disp_46[] = { 1 };
+table const table_46 = { "dummy", fields_46, 1, by_index_46, 1, names_46, 1, disp_46, 0 };
+
+field const fields_47[] = {
+  { 11, "map_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 12, "x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 13, "y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 21, "def_dir", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 22, "talk_dir", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 23, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 24, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 31, "action", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 32, "freq", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 33, "start_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 34, "priority_type", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 35, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 36, "anime_type", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 37, "speed", LCF::schema::integer, NULL, true, 3, 0.0, NULL },
+  { 41, "move", LCF::schema::array1d, &table_45, false, 0, 0.0, NULL },
+  { 43, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 46, "is_trans", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 52, "counter", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 53, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 54, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 71, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 72, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 73, "char_set", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 74, "char_set_pos", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 75, "char_set_pat", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+  { 81, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 82, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 83, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 101, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 103, "vehicle", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 108, "dummy", LCF::schema::array1d, &table_46, false, 0, 0.0, NULL },
+  { 121, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 131, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 132, "dummy", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_47[] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[0], &fields_47[1], &fields_47[2], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[3], &fields_47[4], &fields_47[5], &fields_47[6], NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[7], &fields_47[8], &fields_47[9], &fields_47[10], &fields_47[11], &fields_47[12], &fields_47[13], NULL, NULL, NULL, &fields_47[14], NULL, &fields_47[15], NULL, NULL, &fields_47[16], NULL, NULL, NULL, NULL, NULL, &fields_47[17], &fields_47[18], &fields_47[19], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[20], &fields_47[21], &fields_47[22], &fields_47[23], &fields_47[24], NULL, NULL, NULL, NULL, NULL, &fields_47[25], &fields_47[26], &fields_47[27], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[28], NULL, &fields_47[29], NULL, NULL, NULL, NULL, &fields_47[30], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[31], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_47[32], &fields_47[33] };
+int16_t const names_47[] = { -1, -1, 0, -1, -1, -1, -1, -1, -1, 16, -1, -1, 29, -1, -1, -1, 23, 17, 22, 24, -1, -1, -1, -1, -1, -1, -1, 1, 8, -1, 9, -1, -1, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, 2, 3, -1, -1, -1, -1, 4, -1, 10, 5, -1, 14, -1, -1, -1, 12 };
+uint32_t const disp_47[] = { 1, 1, 1, 2, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0, 0, 2 };
+table const table_47 = { "event_state", fields_47, 34, by_index_47, 132, names_47, 63, disp_47, 15 };
+
+field const fields_48[] = {
+  { 1, "name", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 2, "title", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 3, "semi_trans", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 11, "char_set", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 12, "char_set_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 13, "trans", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 21, "face_set", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 22, "face_set_pos", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 31, "level", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 32, "exp", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 33, "hp_max", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 34, "mp_max", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 41, "attack", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 42, "gaurd", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 43, "mind", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 44, "speed", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 51, "skill_len", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 52, "skill", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 61, "equipment", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 71, "cur_hp", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 72, "cur_mp", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 81, "condition_step_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 82, "condition_step", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 83, "condition_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 84, "condition", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 90, "job", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 91, "double_hand", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_48[] = { NULL, &fields_48[0], &fields_48[1], &fields_48[2], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[3], &fields_48[4], &fields_48[5], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[6], &fields_48[7], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[8], &fields_48[9], &fields_48[10], &fields_48[11], NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[12], &fields_48[13], &fields_48[14], &fields_48[15], NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[16], &fields_48[17], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[18], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[19], &fields_48[20], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_48[21], &fields_48[22], &fields_48[23], &fields_48[24], NULL, NULL, NULL, NULL, NULL, &fields_48[25], &fields_48[26] };
+int16_t const names_48[] = { -1, -1, -1, -1, 6, -1, -1, 23, 4, 0, -1, 13, 24, 16, -1, -1, -1, -1, 17, -1, -1, -1, -1, 20, -1, 11, 19, 26, -1, 12, 21, 18, -1, -1, -1, -1, 5, -1, -1, -1, 25, 7, -1, -1, 14, -1, 9, -1, -1, 10, -1, -1, -1, -1, 1, 2, 15, -1, 22, -1, 3, -1, 8, -1 };
+uint32_t const disp_48[] = { 1, 3, 0, 1, 2, 1, 1, 1, 2, 1, 0, 3, 1, 1, 0, 1 };
+table const table_48 = { "actor", fields_48, 27, by_index_48, 91, names_48, 63, disp_48, 15 };
+
+field const fields_49[] = {
+  { 1, "member", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 2, "member", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 11, "item_type_num", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 12, "item_id", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 13, "item_num", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 14, "item_use", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+  { 21, "money", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 23, "timer1_secs", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 24, "timer1_active", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 25, "timer1_visible", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 26, "timer1_battle", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 27, "timer2_secs", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 28, "timer2_active", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 29, "timer2_visible", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 30, "timer2_battle", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 32, "battle", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 33, "loss", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 34, "win", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 35, "escape", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 41, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 42, "dummy", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_49[] = { NULL, &fields_49[0], &fields_49[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_49[2], &fields_49[3], &fields_49[4], &fields_49[5], NULL, NULL, NULL, NULL, NULL, NULL, &fields_49[6], NULL, &fields_49[7], &fields_49[8], &fields_49[9], &fields_49[10], &fields_49[11], &fields_49[12], &fields_49[13], &fields_49[14], NULL, &fields_49[15], &fields_49[16], &fields_49[17], &fields_49[18], NULL, NULL, NULL, NULL, NULL, &fields_49[19], &fields_49[20] };
+int16_t const names_49[] = { -1, -1, -1, -1, 18, -1, 3, -1, -1, 15, -1, -1, -1, -1, 17, -1, -1, -1, -1, -1, -1, -1, 12, 16, -1, -1, -1, -1, -1, 13, -1, -1, -1, 14, 2, 8, 9, 7, -1, 5, -1, -1, -1, -1, -1, 4, -1, -1, 0, -1, -1, -1, 10, -1, 6, -1, -1, 19, 11, -1, -1, -1, -1, -1 };
+uint32_t const disp_49[] = { 1, 0, 0, 1, 1, 1, 1, 1, 0, 3, 4, 2, 1, 1, 0, 1 };
+table const table_49 = { "inventory", fields_49, 21, by_index_49, 42, names_49, 63, disp_49, 15 };
+
+field const fields_50[] = {
+  { 1, "map_id", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 2, "x", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 3, "y", LCF::schema::integer, NULL, true, 0, 0.0, NULL },
+  { 4, "on_after_teleport", LCF::schema::bool_, NULL, true, 0, 0.0, NULL },
+  { 5, "switch_id", LCF::schema::integer, NULL, true, 1, 0.0, NULL },
+};
+field const* const by_index_50[] = { NULL, &fields_50[0], &fields_50[1], &fields_50[2], &fields_50[3], &fields_50[4] };
+int16_t const names_50[] = { 2, -1, 0, -1, -1, 4, -1, -1, -1, -1, 1, 3, -1, -1, -1, -1 };
+uint32_t const disp_50[] = { 2, 1, 1, 1 };
+table const table_50 = { "teleport", fields_50, 5, by_index_50, 5, names_50, 15, disp_50, 3 };
+
+field const fields_51[] = {
+  { 1, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 3, "encount_rate", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 5, "chip_set_id", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 11, "info", LCF::schema::array2d, &table_47, false, 0, 0.0, NULL },
+  { 21, "lower", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 22, "upper", LCF::schema::int16array, NULL, false, 0, 0.0, NULL },
+  { 31, "use_panorama", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 32, "panorama", LCF::schema::string, NULL, false, 0, 0.0, NULL },
+  { 33, "horizontal_scroll", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 34, "vertical_scroll", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 35, "horizontal_scroll_auto", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 36, "horizontal_scroll_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 37, "vertical_scroll_auto", LCF::schema::bool_, NULL, false, 0, 0.0, NULL },
+  { 38, "vertical_scroll_speed", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_51[] = { NULL, &fields_51[0], NULL, &fields_51[1], NULL, &fields_51[2], NULL, NULL, NULL, NULL, NULL, &fields_51[3], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_51[4], &fields_51[5], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_51[6], &fields_51[7], &fields_51[8], &fields_51[9], &fields_51[10], &fields_51[11], &fields_51[12], &fields_51[13] };
+int16_t const names_51[] = { -1, 3, 7, -1, -1, 12, -1, -1, -1, 13, -1, 8, 5, -1, -1, -1, -1, 4, 9, 10, -1, -1, 6, -1, 2, 0, -1, -1, 11, -1, -1, 1 };
+uint32_t const disp_51[] = { 1, 1, 0, 1, 2, 3, 4, 1 };
+table const table_51 = { "event_data", fields_51, 14, by_index_51, 38, names_51, 31, disp_51, 7 };
+
+field const* const by_index_52[] = { NULL };
+int16_t const names_52[] = { -1 };
+uint32_t const disp_52[] = { 0 };
+table const table_52 = { "dummy", NULL, 0, by_index_52, 0, names_52, 0, disp_52, 0 };
+
+field const fields_53[] = {
+  { 1, "event_length", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 2, "dummy", LCF::schema::event, NULL, false, 0, 0.0, NULL },
+  { 11, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 12, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 13, "dummy", LCF::schema::event, NULL, false, 0, 0.0, NULL },
+  { 21, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+  { 22, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_53[] = { NULL, &fields_53[0], &fields_53[1], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_53[2], &fields_53[3], &fields_53[4], NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_53[5], &fields_53[6] };
+int16_t const names_53[] = { 1, -1, 0, -1 };
+uint32_t const disp_53[] = { 4 };
+table const table_53 = { "dummy", fields_53, 7, by_index_53, 22, names_53, 3, disp_53, 0 };
+
+field const fields_54[] = {
+  { 1, "dummy", LCF::schema::array2d, &table_53, false, 0, 0.0, NULL },
+  { 4, "dummy", LCF::schema::integer, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_54[] = { NULL, &fields_54[0], NULL, NULL, &fields_54[1] };
+int16_t const names_54[] = { -1, 0 };
+uint32_t const disp_54[] = { 1 };
+table const table_54 = { "dummy", fields_54, 2, by_index_54, 4, names_54, 1, disp_54, 0 };
+
+field const fields_55[] = {
+  { 1, "dummy", LCF::schema::int8array, NULL, false, 0, 0.0, NULL },
+};
+field const* const by_index_55[] = { NULL, &fields_55[0] };
+int16_t const names_55[] = { -1, 0 };
+uint32_t const disp_55[] = { 1 };
+table const table_55 = { "dummy", fields_55, 1, by_index_55, 1, names_55, 1, disp_55, 0 };
+
+field const fields_56[] = {
+  { 1, "dummy", LCF::schema::array1d, &table_55, false, 0, 0.0, NULL },
+};
+field const* const by_index_56[] = { NULL, &fields_56[0] };
+int16_t const names_56[] = { -1, 0 };
+uint32_t const disp_56[] = { 1 };
+table const table_56 = { "dummy", fields_56, 1, by_index_56, 1, names_56, 1, disp_56, 0 };
+
+field const fields_57[] = {
+  { 100, "Preview", LCF::schema::array1d, &table_41, false, 0, 0.0, NULL },
+  { 101, "system", LCF::schema::array1d, &table_42, false, 0, 0.0, NULL },
+  { 102, "screen", LCF::schema::array1d, &table_43, false, 0, 0.0, NULL },
+  { 103, "picture", LCF::schema::array2d, &table_44, false, 0, 0.0, NULL },
+  { 104, "party", LCF::schema::array1d, &table_47, false, 0, 0.0, NULL },
+  { 105, "boat", LCF::schema::array1d, &table_47, false, 0, 0.0, NULL },
+  { 106, "ship", LCF::schema::array1d, &table_47, false, 0, 0.0, NULL },
+  { 107, "Airship", LCF::schema::array1d, &table_47, false, 0, 0.0, NULL },
+  { 108, "actor", LCF::schema::array2d, &table_48, false, 0, 0.0, NULL },
+  { 109, "inventory", LCF::schema::array1d, &table_49, false, 0, 0.0, NULL },
+  { 110, "teleport", LCF::schema::array2d, &table_50, false, 0, 0.0, NULL },
+  { 111, "event_data", LCF::schema::array1d, &table_51, false, 0, 0.0, NULL },
+  { 112, "dummy", LCF::schema::array1d, &table_52, false, 0, 0.0, NULL },
+  { 113, "dummy", LCF::schema::array1d, &table_54, false, 0, 0.0, NULL },
+  { 114, "dummy", LCF::schema::array2d, &table_56, false, 0, 0.0, NULL },
+};
+field const* const by_index_57[] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &fields_57[0], &fields_57[1], &fields_57[2], &fields_57[3], &fields_57[4], &fields_57[5], &fields_57[6], &fields_57[7], &fields_57[8], &fields_57[9], &fields_57[10], &fields_57[11], &fields_57[12], &fields_57[13], &fields_57[14] };
+int16_t const names_57[] = { -1, -1, -1, -1, 3, -1, 2, -1, -1, -1, -1, -1, -1, 6, -1, -1, 4, -1, -1, 7, 1, -1, -1, 11, 9, 12, 10, 5, -1, -1, 0, 8 };
+uint32_t const disp_57[] = { 1, 1, 0, 3, 1, 0, 0, 1 };
+table const table_57 = { "global", fields_57, 15, by_index_57, 114, names_57, 31, disp_57, 7 };
+
+field const root_0[] = {
+  { 0, "global", LCF::schema::array1d, &table_32, false, 0, 0.0, NULL },
+};
+field const root_1[] = {
+  { 0, "global", LCF::schema::array2d, &table_34, false, 0, 0.0, NULL },
+  { 0, "map_tree", LCF::schema::map_tree, NULL, false, 0, 0.0, NULL },
+  { 0, "start_point", LCF::schema::array1d, &table_35, false, 0, 0.0, NULL },
+};
+field const root_2[] = {
+  { 0, "global", LCF::schema::array1d, &table_40, false, 0, 0.0, NULL },
+};
+field const root_3[] = {
+  { 0, "global", LCF::schema::array1d, &table_57, false, 0, 0.0, NULL },
+};
 
-  "{\"type\":\"array1d\",\"name\":\"sound\",\"value\":[{\"index\":1,\"type\":\"string\",\"name\":\"name\"},{\"index\":3,\"type\":\"integer\",\"name\":\"volume\",\"value\":100},{\"index\":4,\"type\":\"integer\",\"name\":\"tempo\",\"value\":100},{\"index\":5,\"type\":\"integer\",\"name\":\"balance\",\"value\":50}]}",
+}
 
-  NULL,
+namespace LCF {
+namespace schema {
+file const files[] = {
+  { "LcfDataBase", root_0, 1 },
+  { "LcfMapTree", root_1, 3 },
+  { "LcfMapUnit", root_2, 1 },
+  { "LcfSaveData", root_3, 1 },
 };
+size_t const file_count = sizeof(files) / sizeof(files[0]);
+}
+}
@@ -1,10 +1,13 @@
+#include "lcf_preloader.hxx"
 #include "lcf_reader.hxx"
 #include "lcf_stream.hxx"
 
 #include <fstream>
 #include <sstream>
 #include <memory>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <boost/assign/list_of.hpp>
 #include <boost/variant.hpp>
@@ -31,6 +34,8 @@ void open_lmt(mrb_state* M) {
 
 	picojson tmp;
 	lmt.to_json(tmp);
+	// second pass goes through the cached chunk indices
+	easyrpg_verify(tmp == to_json(lmt));
 
 	std::shared_ptr<std::stringstream> const ios =
 			std::make_shared<std::stringstream>(stream_flag);
@@ -39,6 +44,29 @@ void open_lmt(mrb_state* M) {
 	ios->seekg(0);
 
 	easyrpg_verify(tmp == to_json(LCF::lcf_file(ios)));
+
+	std::string const data = ios->str();
+	LCF::vector<char> buf(data.begin(), data.end());
+	easyrpg_verify(tmp == to_json(LCF::lcf_file(LCF::buffer::own(buf))));
+}
+
+void test_preloader(mrb_state* M) {
+	picojson const expected = to_json(LCF::lcf_file(lmt_path));
+
+	LCF::preloader p(10810, 0);
+	p.preload(list_of(lmt_path).convert_to_container<LCF::vector<std::string> >());
+
+	LCF::lcf_file lmt;
+	LCF::vector<int32_t> links;
+	p.take(lmt_path, lmt, links);
+	easyrpg_verify(lmt.valid());
+	easyrpg_verify(links.empty());
+	easyrpg_verify(expected == to_json(lmt));
+
+	// files never requested are loaded by the caller
+	p.take(lmt_path + ".none", lmt, links);
+	easyrpg_verify(not lmt.valid());
+	easyrpg_verify(not lmt.error().empty());
 }
 
 /*
@@ -71,13 +99,68 @@ void test_ber(mrb_state* M) {
 		LCF::ber(ss, r);
 		ss.seekg(0);
 		easyrpg_verify(LCF::ber(ss) == r);
+
+		std::string const str = ss.str();
+		uint8_t const* p = reinterpret_cast<uint8_t const*>(str.data());
+		easyrpg_verify(LCF::ber(p, p + str.size()) == r);
+		easyrpg_verify(p == reinterpret_cast<uint8_t const*>(str.data() + str.size()));
+	}
+}
+
+void test_string(mrb_state* M) {
+	std::string const utf8 = "EasyRPG \xe3\x81\x82\xe3\x82\xa2\xe6\xbc\xa2\xe5\xad\x97";
+	std::string const sjis = LCF::convert(utf8, "CP932", "UTF-8");
+	easyrpg_verify(LCF::encode_string(utf8) == sjis);
+	// the decoding table agrees with iconv
+	easyrpg_verify(LCF::read_string(reinterpret_cast<uint8_t const*>(sjis.data()), sjis.size()) == utf8);
+}
+
+void check_table(mrb_state* M, LCF::schema::table const& t) {
+	namespace schema = LCF::schema;
+
+	for(size_t i = 0; i < t.field_count; ++i) {
+		schema::field const& f = t.fields[i];
+		// the perfect hash in schema.cxx must agree with schema::hash
+		schema::field const* const by_name = schema::find(t, f.name, std::strlen(f.name));
+		easyrpg_verify(by_name and std::strcmp(by_name->name, f.name) == 0);
+		easyrpg_verify(schema::find(t, f.index) and schema::find(t, f.index)->index == f.index);
+
+		if(f.value) { check_table(M, *f.value); }
+	}
+	easyrpg_verify(not schema::find(t, "no_such_field", 13));
+}
+
+void test_schema(mrb_state* M) {
+	for(size_t i = 0; i < LCF::schema::file_count; ++i) {
+		LCF::schema::file const& f = LCF::schema::files[i];
+		easyrpg_verify(LCF::schema::find_file(f.signature, std::strlen(f.signature)) == &f);
+		for(size_t r = 0; r < f.root_count; ++r) {
+			if(f.root[r].value) { check_table(M, *f.root[r].value); }
+		}
 	}
+	easyrpg_verify(not LCF::schema::find_file("LcfUnknown", 10));
+}
+
+// removes a file written by the ruby tests with its temporary file
+mrb_value remove_test_file(mrb_state* M, mrb_value) {
+	char* path;
+	mrb_get_args(M, "z", &path);
+	std::remove((std::string(path) + ".tmp").c_str());
+	return mrb_bool_value(std::remove(path) == 0);
 }
 
 }
 
 extern "C" void mrb_lcf_reader_gem_test(mrb_state* M) {
+	static EasyRPG::method_info const test_methods[] = {
+		{ "remove_test_file", &remove_test_file, MRB_ARGS_REQ(1) },
+		EasyRPG::method_info_end };
+	EasyRPG::define_module(M, "LCF", test_methods);
+
 	test_ber(M);
+	test_string(M);
+	test_schema(M);
 	open_lmt(M);
+	test_preloader(M);
 	// open_ldb(M);
 }
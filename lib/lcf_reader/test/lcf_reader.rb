@@ -1,3 +1,32 @@
 assert 'Dummy LCF Reader Test' do
   true
 end
+
+assert 'LCF.save_lcf writes ruby values' do
+  path = 'lcf_reader_test.lmu'
+  begin
+    data = {
+      signature: 'LcfMapUnit',
+      root: [{
+        width: 4, height: 2, chipset_id: 3,
+        lower_layer: [1, -2, 3, 4, 5, 6, 7, 30000],
+        upper_layer: [9, 8, 7, 6, 5, 4, 3, 2],
+        'event' => { 1 => { name: 'EV0001', x: 2, y: 1 } },
+      }],
+    }
+    assert_true LCF.save_lcf(data, path)
+
+    lmu = LCF::LcfFile.new path
+    assert_true lmu.valid?
+    assert_equal 4, lmu[:width]
+    assert_equal [1, -2, 3, 4, 5, 6, 7, 30000], lmu[:lower_layer].to_ary
+    assert_equal 'EV0001', lmu[:event][1].name
+
+    # loaded arrays are copied as is
+    assert_true LCF.save_lcf({ signature: 'LcfMapUnit', root: [lmu.root(0)] }, path)
+    assert_equal lmu.to_json, LCF::LcfFile.new(path).to_json
+  ensure
+    # drop the file and a leftover of a failed write
+    LCF.remove_test_file path
+  end
+end
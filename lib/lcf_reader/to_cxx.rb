@@ -6,16 +6,148 @@ require 'json'
 # usage> to_cxx.rb INPUT_DIRECTORY OUTPUT
 raise "argument error" unless ARGV.length == 2
 
+BASIC_TYPES = %w[integer bool float string event map_tree
+                 int8array int16array int32array ber_array]
+CXX_TYPES = Hash[(BASIC_TYPES + %w[array1d array2d]).map { |v|
+                   [v, "LCF::schema::#{%w[bool float].include?(v) ? v + '_' : v}"] }]
+
+# same as LCF::schema::hash
+def fnv1a(str, seed)
+  h = 2166136261 ^ seed
+  str.each_byte { |c| h = ((h ^ c) * 16777619) & 0xffffffff }
+  # mix high bits into the masked low bits
+  h ^= h >> 16
+  h = (h * 0x85ebca6b) & 0xffffffff
+  h ^ (h >> 13)
+end
+
+class SchemaTables
+  def initialize(schemas)
+    @named = {}
+    schemas.each { |v| @named[v['name']] = v unless v.key? 'signature' }
+    @tables = {}
+    @out = []
+  end
+
+  attr_reader :out
+
+  def c_str(v) v.nil? ? 'NULL' : JSON.dump(v) end
+
+  # hash and displace: names are grouped in buckets by fnv1a(name, 0),
+  # each bucket gets the seed mapping its names to free slots
+  def perfect_hash(names)
+    size = 1
+    size *= 2 while size < names.size * 2
+    buckets = Array.new([size / 4, 1].max) { [] }
+    names.each_key { |n| buckets[fnv1a(n, 0) & (buckets.size - 1)] << n }
+
+    slots = Array.new(size, -1)
+    disp = Array.new(buckets.size, 0)
+    buckets.each_with_index.sort_by { |b, i| [-b.size, i] }.each { |b, i|
+      next if b.empty?
+      d = (1..Float::INFINITY).find { |s|
+        pos = b.map { |n| fnv1a(n, s) & (size - 1) }
+        pos.uniq.size == pos.size and pos.all? { |v| slots[v] == -1 }
+      }
+      b.each { |n| slots[fnv1a(n, d) & (size - 1)] = names[n] }
+      disp[i] = d
+    }
+    [slots, disp]
+  end
+
+  # emits the table of a json array schema and returns its symbol
+  def table(name, fields)
+    return @tables[fields.object_id] if @tables.key? fields.object_id
+
+    sorted = fields.each_with_index.sort_by { |f, i| [f['index'], i] }.map { |f, i| f }
+    field_syms = sorted.map { |f| field f }
+    id = @tables.size
+    sym = "table_#{id}"
+
+    unless sorted.empty?
+      @out << "field const fields_#{id}[] = {"
+      field_syms.each { |v| @out << "  #{v}," }
+      @out << "};"
+    end
+
+    max_index = sorted.map { |f| f['index'] }.max || 0
+    by_index = Array.new(max_index + 1, 'NULL')
+    sorted.each_with_index { |f, i|
+      by_index[f['index']] = "&fields_#{id}[#{i}]" if by_index[f['index']] == 'NULL'
+    }
+    @out << "field const* const by_index_#{id}[] = { #{by_index.join ', '} };"
+
+    # first field of each name in schema order
+    names = {}
+    fields.each { |f| names[f['name']] ||= sorted.index { |v| v.equal? f } }
+    slots, disp = perfect_hash names
+    @out << "int16_t const names_#{id}[] = { #{slots.join ', '} };"
+    @out << "uint32_t const disp_#{id}[] = { #{disp.join ', '} };"
+
+    @out << "table const #{sym} = { #{c_str name}, #{sorted.empty? ? 'NULL' : "fields_#{id}"}, #{sorted.size}," \
+            " by_index_#{id}, #{max_index}, names_#{id}, #{slots.size - 1}, disp_#{id}, #{disp.size - 1} };"
+    @out << ""
+    @tables[fields.object_id] = sym
+  end
+
+  def field(f)
+    type = f['type']
+    value = f['value']
+    has_default = (not value.nil?) && (not value.is_a? Array) && (not %w[array1d array2d].include? type)
+
+    if BASIC_TYPES.include? type
+      tbl = 'NULL'
+    elsif %w[array1d array2d].include? type
+      sch = value.is_a?(Array) ? f : @named[value]
+      raise "unknown schema: #{value}" if sch.nil?
+      tbl = '&' + table(sch['name'], sch['value'])
+    else
+      sch = @named[type]
+      raise "unknown type: #{type}" if sch.nil?
+      type = sch['type']
+      tbl = '&' + table(sch['name'], sch['value'])
+    end
+
+    int_value = has_default && %w[integer bool].include?(type) ? (value == true ? 1 : value == false ? 0 : value.to_i) : 0
+    float_value = has_default && type == 'float' ? value.to_f : 0.0
+    string_value = has_default && type == 'string' ? value : nil
+
+    "{ #{f['index'] || 0}, #{c_str f['name']}, #{CXX_TYPES[type]}, #{tbl}," \
+    " #{has_default}, #{int_value}, #{float_value}, #{c_str string_value} }"
+  end
+end
+
+schemas = Dir.glob("#{ARGV[0]}/*.json").map { |f|
+  # check json
+  [f, JSON.parse(IO.read(f))]
+}
+
 out = File.open(ARGV[1], "w")
 
 out.write "#include <cstdlib>\n"
-out.write "extern char const* LCF_SCHEMA_JSON_STRING[];\n"
-out.write "char const* LCF_SCHEMA_JSON_STRING[] = {\n"
+out.write "#include \"lcf_schema.hxx\"\n\n"
 
-Dir.glob("#{ARGV[0]}/*.json") { |f|
-  # check json
-  out.write "  \"" + JSON.dump(JSON.parse(IO.read(f))).gsub("\"", "\\\"") + "\",\n\n"
+tables = SchemaTables.new schemas.map { |f, json| json }
+files = schemas.map { |f, json| json }.select { |v| v.key? 'signature' }.map { |json|
+  [json['signature'], json['root'].map { |v| tables.field v }]
 }
 
-out.write "  NULL,\n"
+out.write "namespace {\n\n"
+out.write "using LCF::schema::field;\n"
+out.write "using LCF::schema::table;\n\n"
+tables.out.each { |v| out.write v + "\n" }
+files.each_with_index { |(sig, root), i|
+  out.write "field const root_#{i}[] = {\n"
+  root.each { |v| out.write "  #{v},\n" }
+  out.write "};\n"
+}
+out.write "\n}\n\n"
+
+out.write "namespace LCF {\nnamespace schema {\n"
+out.write "file const files[] = {\n"
+files.each_with_index { |(sig, root), i|
+  out.write "  { #{JSON.dump sig}, root_#{i}, #{root.size} },\n"
+}
 out.write "};\n"
+out.write "size_t const file_count = sizeof(files) / sizeof(files[0]);\n"
+out.write "}\n}\n"
@@ -103,6 +103,7 @@ class Game_Event < Game_Character
       @priority_type = @page.priority_type
       @trigger = @page.trigger
       @list = @page.event
+      prefetch_graphics
       @through = false
 
       @interpreter = Game_Interpreter_Map.new if @trigger == RPG::EventPage::Trigger_parallel
@@ -110,6 +111,13 @@ class Game_Event < Game_Character
     end
   end
 
+  # Queues the pictures and faces shown by the page for background decoding.
+  # The names are collected by the page itself, no command is created here.
+  def prefetch_graphics
+    @list.strings(Cmd::ShowPicture).each { |v| Cache.prefetch :picture, v }
+    @list.strings(Cmd::ChangeFaceGraphic).each { |v| Cache.prefetch :faceset, v }
+  end
+
   FlagSwitch1 = 0x1 << 0
   FlagSwitch2 = 0x1 << 1
   FlagVariable = 0x01 << 2
@@ -13,7 +13,10 @@
 # You should have received a copy of the GNU General Public License
 # along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
 
-module Game_Map; end
+module Game_Map
+  # Maps kept loaded in the background at most.
+  PRELOAD_LIMIT = 8
+end
 
 class << Game_Map
   attr_reader :interpreter
@@ -52,12 +55,16 @@ class << Game_Map
     location.pan_current_x, location.pan_current_y = 0, 0
 
     @panorama_x, @panorama_y = 0, 0
+
+    # the map tree may have been reloaded
+    @map_children = nil
   end
 
   # Quits (frees) Game_Map.
   def quit
     dispose
     @interpreter = nil
+    @preloader = nil
   end
 
   # Disposes Game_Map.
@@ -68,6 +75,7 @@ class << Game_Map
     $game_screen.reset unless $game_screen.nil?
 
     @map = nil
+    @lower_layer, @upper_layer = nil, nil
   end
 
   # Setups a map.
@@ -79,9 +87,12 @@ class << Game_Map
     dispose
 
     location.map_id = map_id
-    @map = LCF::LcfFile.new FileFinder.find_default('Map%04d.lmu' % location.map_id)
+    # usually loaded by the preloader while the previous map was running
+    @map, links = preloader.take map_file(location.map_id)
     Output.error('lmu load error: ' + @map.error) unless @map.error.nil?
     @map = @map.root 0
+    # decoded once and shared with the tilemap
+    @lower_layer, @upper_layer = @map.lower_layer, @map.upper_layer
 
     if @map.use_panorama
       self.panorama_name = @map.panorama_name
@@ -91,6 +102,7 @@ class << Game_Map
     else; self.panorama_name = ''; end
 
     self.chipset = @map.chipset_id
+    prefetch_graphics
     @display_x, @display_y = 0, 0
     @need_refresh = true
 
@@ -111,6 +123,60 @@ class << Game_Map
     location.pan_finish_y = 0
     location.pan_current_x = 0
     location.pan_current_y = 0
+
+    preload_neighbors links
+  end
+
+  # Queues the graphics of the map for decoding in the background,
+  # so they are ready when the spriteset or a page change needs them.
+  def prefetch_graphics
+    Cache.prefetch :chipset, @chipset_name
+    Cache.prefetch :panorama, map_info.panorama_name if @map.use_panorama
+    @map.event.each { |_, ev|
+      ev.page.each { |_, page|
+        charset = page[:charset]
+        Cache.prefetch :charset, charset unless charset.nil?
+      }
+    }
+  end
+
+  # Background loader of the maps the party may enter next.
+  def preloader
+    @preloader ||= LCF::Preloader.new Cmd::Teleport, 0
+  end
+
+  # Gets the path of a map file.
+  #
+  # @param map_id map ID.
+  # @return path, or an empty string if the map doesn't exist.
+  def map_file(map_id)
+    FileFinder.find_default('Map%04d.lmu' % map_id)
+  end
+
+  # Queues the maps next to the current one for preloading:
+  # teleport targets first, then the map tree parent, children and siblings.
+  #
+  # @param links target map IDs of the teleports in the current map.
+  def preload_neighbors(links)
+    ids = (links + map_tree_neighbors(location.map_id)).uniq
+    ids.delete location.map_id
+    preloader.preload ids.select { |v| v > 0 }.first(Game_Map::PRELOAD_LIMIT).map { |v| map_file v }
+  end
+
+  # Gets the parent, children and siblings of a map in the map tree.
+  #
+  # @param map_id map ID.
+  # @return map IDs.
+  def map_tree_neighbors(map_id)
+    if @map_children.nil?
+      @map_children = {}
+      Data.treemap.root(0).each { |k, v|
+        (@map_children[v.parent] ||= []) << k if k != v.parent
+      }
+    end
+
+    parent = Data.treemap[map_id].parent
+    (@map_children[map_id] || []) + [parent] + (@map_children[parent] || [])
   end
 
   # Runs map.
@@ -223,21 +289,21 @@ class << Game_Map
 
     tile_index = x + y * width
 
-    tile_id = @map.upper_layer[tile_index] - BLOCK_F
+    tile_id = @upper_layer[tile_index] - BLOCK_F
     tile_id = map_info.upper[tile_id]
 
     return false if ((passages_up[tile_id] & bit) == 0)
     return true if ((passages_up[tile_id] & Passable::Above) == 0)
 
-    if @map.lower_layer[tile_index] >= BLOCK_E
-      tile_id = @map.lower_layer[tile_index] - BLOCK_E
+    if @lower_layer[tile_index] >= BLOCK_E
+      tile_id = @lower_layer[tile_index] - BLOCK_E
       tile_id = map_info.lower[tile_id]
       tile_id += 18
 
       return false if ((passages_down[tile_id] & bit) == 0)
-    elsif @map.lower_layer[tile_index] >= BLOCK_D
-      tile_id = (@map.lower_layer[tile_index] - BLOCK_D) / 50
-      autotile_id = @map.lower_layer[tile_index] - BLOCK_D - tile_id * 50
+    elsif @lower_layer[tile_index] >= BLOCK_D
+      tile_id = (@lower_layer[tile_index] - BLOCK_D) / 50
+      autotile_id = @lower_layer[tile_index] - BLOCK_D - tile_id * 50
       tile_id += 6
 
       return true if (((passages_down[tile_id] & Passable::Wall) != 0) &&
@@ -248,11 +314,11 @@ class << Game_Map
                        autotile_id == 45
                        ))
       return false if ((passages_down[tile_id] & bit) == 0)
-    elsif @map.lower_layer[tile_index] >= BLOCK_C
-      tile_id = (@map.lower_layer[tile_index] - BLOCK_C) / 50 + 3
+    elsif @lower_layer[tile_index] >= BLOCK_C
+      tile_id = (@lower_layer[tile_index] - BLOCK_C) / 50 + 3
       return false if ((passages_down[tile_id] & bit) == 0)
-    elsif @map.lower_layer[tile_index] < BLOCK_C
-      tile_id = @map.lower_layer[tile_index] / 1000
+    elsif @lower_layer[tile_index] < BLOCK_C
+      tile_id = @lower_layer[tile_index] / 1000
       return false if ((passages_down[tile_id] & bit) == 0)
     end
 
@@ -273,7 +339,7 @@ class << Game_Map
   # @return whether has the counter flag.
   def counter?(x, y)
     return false if !Game_Map.valid?(x, y)
-    tile_id = @map.upper_layer[x + y * width]
+    tile_id = @upper_layer[x + y * width]
     return false if tile_id < BLOCK_F
     index = map_info.lower[passages_up[tile_id - BLOCK_F]]
     (Data.chipset[map_info.chipset_id].passable_data_upper[index] & Passable::Counter) != 0
@@ -285,7 +351,7 @@ class << Game_Map
   # @param y tile y.
   # @return terrain tag ID.
   def terrain_tag(x, y)
-    chipID = @map.lower_layer[x + y * width]
+    chipID = @lower_layer[x + y * width]
     chip_index =
       (chipID <  3000)?  0 + chipID/1000 :
       (chipID == 3028)?  3 + 0 :
@@ -410,12 +476,12 @@ class << Game_Map
   # Gets lower layer map data.
   #
   # @return lower layer map data.
-  def map_data_down; @map.lower_layer; end
+  def map_data_down; @lower_layer; end
 
   # Gets upper layer map data.
   #
   # @return upper layer map data.
-  def map_data_up; @map.upper_layer; end
+  def map_data_up; @upper_layer; end
 
   attr_accessor :display_x, :display_y, :need_refresh, :chipset_name, :battleback_name
 
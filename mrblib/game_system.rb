@@ -65,6 +65,7 @@ class << Game_System
 
   # Initializes Game System.
   def init
+    Player.system_graphic = system_name
   end
 
   # Plays a Music.
@@ -105,7 +106,11 @@ class << Game_System
   # Sets the system graphic.
   #
   # @param system_name new system name.
-  def system_name=(v); data.graphics_name = v; end
+  def system_name=(v)
+    data.system = v
+    # Text drawing reads it natively
+    Player.system_graphic = system_name
+  end
 
   # Gets the system music.
   #
@@ -0,0 +1,27 @@
+# This file is part of EasyRPG Player.
+#
+# EasyRPG Player is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# EasyRPG Player is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+
+module Graphics
+  # Measures the block as frame stats section +name+.
+  # The section is closed in ensure so a raising block doesn't leave it open.
+  def self.profile(name)
+    profile_begin name
+    begin
+      yield
+    ensure
+      profile_end
+    end
+  end
+end
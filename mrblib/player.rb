@@ -2,8 +2,6 @@ module Player
   EngineRpg2k = 0
   EngineRpg2k3 = 1
 
-  @exit_flag = false
-  @reset_flag = false
   @debug_flag = false
   @hide_title_flag = false
   @window_flag = false
@@ -105,11 +103,11 @@ class << Player
 
       @push_pop_operation = SceneNop
       while @push_pop_operation == SceneNop
-        Player.update
+        Graphics.profile(:player_update) { Player.update }
         Graphics.update
-        Audio.update
+        Graphics.profile(:audio_update) { Audio.update }
         Input.update
-        inst.update
+        Graphics.profile(:scene_update) { inst.update }
       end
 
       Graphics.update
@@ -146,7 +144,7 @@ class << Player
       @instances.clear
       @push_pop_operation = ScenePopped
     elsif reset_flag
-      @reset_flag = false
+      self.reset_flag = false
       Player.pop_until 'Title'
     end
   end
@@ -155,5 +153,6 @@ class << Player
               :battle_test_flag, :battle_test_troop_id,
               :instances, :old_instances)
 
-  attr_accessor :reset_flag, :exit_flag, :engine
+  # exit_flag and reset_flag are defined natively, see player.cpp
+  attr_accessor :engine
 end
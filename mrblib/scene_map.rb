@@ -27,6 +27,9 @@ class Scene_Map < Scene
     @message_window = Window_Message.new 0, 240 - 80, 320, 80
     $game_screen.reset
     Graphics.frame_reset
+
+    # shown by the menu and messages
+    Game_Party.actors.each { |v| Cache.prefetch :faceset, v.faceset }
   end
 
   def transition_in
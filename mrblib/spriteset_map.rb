@@ -17,6 +17,7 @@
 class Spriteset_Map
   def initialize
     @tilemap = Tilemap.new
+    @tilemap.chunked = true
     @panorama = Plane.new
     @panorama_name = ''
     @character_sprites = []
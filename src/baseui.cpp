@@ -31,6 +31,10 @@ std::unique_ptr<BaseUi> DisplayUi;
 
 BaseUi::BaseUi() {}
 
+void BaseUi::UpdateDisplay(Rect const&) {
+	UpdateDisplay();
+}
+
 BaseUi::KeyStatus& BaseUi::GetKeyStates() {
 	return keys;
 }
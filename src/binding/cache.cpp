@@ -75,12 +75,51 @@ mrb_value tile(mrb_state* M, mrb_value) {
 		Cache(M).Tile(std::string(str, str_len), id));
 }
 
+mrb_value prefetch(mrb_state* M, mrb_value) {
+	mrb_sym sym; char* str; int str_len;
+	mrb_get_args(M, "ns", &sym, &str, &str_len);
+
+	typedef boost::container::flat_map<std::string, Cache_::Material::Type> materials_type;
+	static materials_type const materials = {
+		{ "backdrop", Cache_::Material::Backdrop },
+		{ "battle", Cache_::Material::Battle },
+		{ "battle2", Cache_::Material::Battle2 },
+		{ "battlecharset", Cache_::Material::Battlecharset },
+		{ "battleweapon", Cache_::Material::Battleweapon },
+		{ "charset", Cache_::Material::Charset },
+		{ "chipset", Cache_::Material::Chipset },
+		{ "faceset", Cache_::Material::Faceset },
+		{ "frame", Cache_::Material::Frame },
+		{ "gameover", Cache_::Material::Gameover },
+		{ "monster", Cache_::Material::Monster },
+		{ "panorama", Cache_::Material::Panorama },
+		{ "picture", Cache_::Material::Picture },
+		{ "system", Cache_::Material::System },
+		{ "system2", Cache_::Material::System2 },
+		{ "title", Cache_::Material::Title },
+	};
+
+	materials_type::const_iterator const it = materials.find(mrb_sym2name(M, sym));
+	if (it == materials.end()) {
+		mrb_raisef(M, mrb_class_get(M, "ArgumentError"), "unknown material: %S", mrb_symbol_value(sym));
+	}
+	return mrb_bool_value(Cache(M).Prefetch(it->second, std::string(str, str_len)).Ready());
+}
+
 mrb_value claer(mrb_state* M, mrb_value self) {
 	CacheReferenceTable::get(M).data.clear();
 	Cache(M).Clear();
 	return self;
 }
 
+mrb_value effect_hits(mrb_state* M, mrb_value) {
+	return mrb_fixnum_value(Cache(M).GetEffectHits());
+}
+
+mrb_value effect_misses(mrb_state* M, mrb_value) {
+	return mrb_fixnum_value(Cache(M).GetEffectMisses());
+}
+
 }
 
 void EasyRPG::register_cache(mrb_state* M) {
@@ -102,7 +141,10 @@ void EasyRPG::register_cache(mrb_state* M) {
 		{ "system", &system, MRB_ARGS_REQ(1) },
 		{ "system2", &system2, MRB_ARGS_REQ(1) },
 		{ "tile", &tile, MRB_ARGS_REQ(2) },
+		{ "prefetch", &prefetch, MRB_ARGS_REQ(2) },
 		{ "clear", &claer, MRB_ARGS_NONE() },
+		{ "effect_hits", &effect_hits, MRB_ARGS_NONE() },
+		{ "effect_misses", &effect_misses, MRB_ARGS_NONE() },
 		method_info_end };
 	define_module(M, "Cache", methods);
 
@@ -1,6 +1,11 @@
 #include "graphics.h"
 #include "binding.hxx"
 
+#include <cstring>
+
+#include <mruby/array.h>
+#include <mruby/hash.h>
+
 namespace {
 
 using namespace EasyRPG;
@@ -47,6 +52,73 @@ mrb_value set_frame_count(mrb_state* M, mrb_value const self) {
 	return Graphics(M).SetFrameCount(v), self;
 }
 
+mrb_value get_damage_tracking(mrb_state* M, mrb_value) {
+	return mrb_bool_value(Graphics(M).GetDamageTracking());
+}
+mrb_value set_damage_tracking(mrb_state* M, mrb_value const self) {
+	mrb_bool v;
+	mrb_get_args(M, "b", &v);
+	return Graphics(M).SetDamageTracking(v), self;
+}
+
+mrb_value get_fps_on_screen(mrb_state* M, mrb_value) {
+	return mrb_bool_value(Graphics(M).fps_on_screen);
+}
+mrb_value set_fps_on_screen(mrb_state* M, mrb_value const self) {
+	mrb_bool v;
+	mrb_get_args(M, "b", &v);
+	return Graphics(M).fps_on_screen = v, self;
+}
+
+mrb_value get_stats_on_screen(mrb_state* M, mrb_value) {
+	return mrb_bool_value(Graphics(M).stats_on_screen);
+}
+mrb_value set_stats_on_screen(mrb_state* M, mrb_value const self) {
+	mrb_bool v;
+	mrb_get_args(M, "b", &v);
+	return Graphics(M).stats_on_screen = v, self;
+}
+
+mrb_value frame_stats(mrb_state* M, mrb_value) {
+	FrameStats const& stats = Graphics(M).GetFrameStats();
+
+	mrb_value const ret = mrb_hash_new(M);
+	mrb_hash_set(M, ret, mrb_symbol_value(mrb_intern_lit(M, "frames")),
+				 mrb_fixnum_value(stats.GetFrameCount()));
+	for (int i = 0; i < FrameStats::SECTION_END; ++i) {
+		FrameStats::Section const s = FrameStats::Section(i);
+		mrb_value const percentiles[] = {
+			mrb_float_value(M, stats.GetPercentile(s, 50)),
+			mrb_float_value(M, stats.GetPercentile(s, 95)),
+			mrb_float_value(M, stats.GetPercentile(s, 99)) };
+		mrb_hash_set(M, ret, mrb_symbol_value(mrb_intern_cstr(M, FrameStats::GetName(s))),
+					 mrb_ary_new_from_values(M, 3, percentiles));
+	}
+	return ret;
+}
+
+// paired by Graphics.profile in an ensure clause, a Scope would be skipped by raising blocks
+mrb_value profile_begin(mrb_state* M, mrb_value const self) {
+	mrb_sym name;
+	mrb_get_args(M, "n", &name);
+
+	char const* const name_str = mrb_sym2name(M, name);
+	for (int i = 0; i < FrameStats::SECTION_END; ++i) {
+		FrameStats::Section const s = FrameStats::Section(i);
+		if (std::strcmp(name_str, FrameStats::GetName(s)) == 0) {
+			return Graphics(M).GetFrameStats().Begin(s), self;
+		}
+	}
+
+	mrb_raisef(M, mrb_class_get(M, "ArgumentError"), "unknown frame stats section: %S",
+			   mrb_symbol_value(name));
+	return mrb_nil_value();
+}
+
+mrb_value profile_end(mrb_state* M, mrb_value const self) {
+	return Graphics(M).GetFrameStats().End(), self;
+}
+
 mrb_value graphics_pop(mrb_state* M, mrb_value const self) {
 	return Graphics(M).Pop(), self;
 }
@@ -68,6 +140,12 @@ void EasyRPG::register_graphics(mrb_state* M) {
 		{ "push", &graphics_push, MRB_ARGS_NONE() },
 		property_methods(frame_rate),
 		property_methods(frame_count),
+		property_methods(damage_tracking),
+		property_methods(fps_on_screen),
+		property_methods(stats_on_screen),
+		{ "frame_stats", &frame_stats, MRB_ARGS_NONE() },
+		{ "profile_begin", &profile_begin, MRB_ARGS_REQ(1) },
+		{ "profile_end", &profile_end, MRB_ARGS_NONE() },
 		method_info_end };
 	RClass* const mod = define_module(M, "Graphics", methods);
 
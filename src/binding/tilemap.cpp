@@ -1,6 +1,7 @@
 #include "bitmap.h"
 #include "tilemap.h"
 #include "binding.hxx"
+#include "lcf_reader.hxx"
 
 #include <mruby/array.h>
 #include <mruby/variable.h>
@@ -26,24 +27,40 @@ std::vector<T> to_cxx_vector(mrb_value* const ary, mrb_int const len) {
 	return ret;
 }
 
+/*
+ * LCF::int16_array from the map file is shared without copying,
+ * any other array is converted.
+ */
+MapDataRef to_map_data(mrb_state* M, mrb_value const& v) {
+	if(is<LCF::int16_array>(M, v)) {
+		return get<LCF::int16_array>(M, v).values();
+	}
+	mrb_value const ary = mrb_check_array_type(M, v);
+	if(mrb_nil_p(ary)) {
+		mrb_raise(M, E_TYPE_ERROR, "map data must be an Array or LCF::int16_array");
+	}
+	return std::make_shared<std::vector<int16_t> const>(
+		to_cxx_vector<int16_t>(RARRAY_PTR(ary), RARRAY_LEN(ary)));
+}
+
 mrb_value get_map_data_down(mrb_state* M, mrb_value const self) {
 	return to_mrb_ary(M, get<Tilemap>(M, self).GetMapDataDown());
 }
 mrb_value set_map_data_down(mrb_state* M, mrb_value const self) {
-	mrb_value* ary; mrb_int len;
-	mrb_get_args(M, "a", &ary, &len);
-	get<Tilemap>(M, self).SetMapDataDown(to_cxx_vector<int16_t>(ary, len));
-	return get_map_data_down(M, self);
+	mrb_value v;
+	mrb_get_args(M, "o", &v);
+	get<Tilemap>(M, self).SetMapDataDown(to_map_data(M, v));
+	return v;
 }
 
 mrb_value get_map_data_up(mrb_state* M, mrb_value const self) {
 	return to_mrb_ary(M, get<Tilemap>(M, self).GetMapDataUp());
 }
 mrb_value set_map_data_up(mrb_state* M, mrb_value const self) {
-	mrb_value* ary; mrb_int len;
-	mrb_get_args(M, "a", &ary, &len);
-	get<Tilemap>(M, self).SetMapDataUp(to_cxx_vector<int16_t>(ary, len));
-	return get_map_data_up(M, self);
+	mrb_value v;
+	mrb_get_args(M, "o", &v);
+	get<Tilemap>(M, self).SetMapDataUp(to_map_data(M, v));
+	return v;
 }
 
 mrb_value get_passable_down(mrb_state* M, mrb_value const self) {
@@ -97,12 +114,21 @@ mrb_value set_visible(mrb_state* M, mrb_value const self) {
 	return get<Tilemap>(M, self).SetVisible(v), get_visible(M, self);
 }
 
-mrb_value substitudte_up(mrb_state* M, mrb_value const self) {
+mrb_value get_chunked(mrb_state* M, mrb_value const self) {
+	return mrb_bool_value(get<Tilemap>(M, self).GetChunked());
+}
+mrb_value set_chunked(mrb_state* M, mrb_value const self) {
+	mrb_bool v;
+	mrb_get_args(M, "b", &v);
+	return get<Tilemap>(M, self).SetChunked(v), get_chunked(M, self);
+}
+
+mrb_value substitute_up(mrb_state* M, mrb_value const self) {
 	mrb_int old_id, new_id;
 	mrb_get_args(M, "ii", &old_id, &new_id);
 	return get<Tilemap>(M, self).SubstituteUp(old_id, new_id), self;
 }
-mrb_value substitudte_down(mrb_state* M, mrb_value const self) {
+mrb_value substitute_down(mrb_state* M, mrb_value const self) {
 	mrb_int old_id, new_id;
 	mrb_get_args(M, "ii", &old_id, &new_id);
 	return get<Tilemap>(M, self).SubstituteDown(old_id, new_id), self;
@@ -141,11 +167,12 @@ void EasyRPG::register_tilemap(mrb_state* M) {
 		property_methods(passable_up), property_methods(passable_down),
 		// property_methods(properties),
 		property_methods(visible),
+		property_methods(chunked),
 		property_methods(ox), property_methods(oy),
 		property_methods(width), property_methods(height),
 		property_methods(animation_speed), property_methods(animation_type),
-		{ "substitudte_down", &substitudte_down, MRB_ARGS_REQ(2) },
-		{ "substitudte_up", &substitudte_up, MRB_ARGS_REQ(2) },
+		{ "substitute_down", &substitute_down, MRB_ARGS_REQ(2) },
+		{ "substitute_up", &substitute_up, MRB_ARGS_REQ(2) },
 		{ "update", &update, MRB_ARGS_NONE() },
 		method_info_end };
 	register_methods(M, define_class<Tilemap>(M, "Tilemap"), methods);
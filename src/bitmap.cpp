@@ -22,16 +22,23 @@
 #include "output.h"
 #include "matrix.h"
 #include "utils.h"
+#include "graphics.h"
+#include "player.h"
 
 #include <pixman.h>
 
+#include <atomic>
 #include <cmath>
+#include <cstring>
 #include <sstream>
 #include <fstream>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include <boost/format.hpp>
-#include <boost/function.hpp>
-#include <boost/bind.hpp>
 #include <boost/math/constants/constants.hpp>
 
 Matrix const Matrix::identity;
@@ -42,6 +49,13 @@ Matrix const Matrix::identity;
 		if(op == 0) { return; }					\
 	} while(false)								\
 
+pixman_color_t to_pixman(Color const& c) {
+	pixman_color_t const ret = {
+		uint16_t(c.red  << 8), uint16_t(c.green << 8),
+		uint16_t(c.blue << 8), uint16_t(c.alpha << 8) };
+	return ret;
+}
+
 namespace {
 
 bool inside_image(Bitmap const& bmp, int const x, int const y) {
@@ -55,39 +69,117 @@ pixman_rectangle16_t to_pixman(Rect const& r) {
 	return ret;
 }
 
-pixman_color_t to_pixman(Color const& c) {
-	pixman_color_t const ret = {
-		uint16_t(c.red  << 8), uint16_t(c.green << 8),
-		uint16_t(c.blue << 8), uint16_t(c.alpha << 8) };
-	return ret;
-}
-
 float const PI = boost::math::constants::pi<float>();
 
+/*
+ * 3x3 color matrix plus offset in 20.12 fixed point.
+ * Alpha is left untouched.
+ */
+struct color_matrix {
+	int32_t m[3][3];
+	int32_t offset[3];
+};
+
+int32_t const COLOR_MATRIX_ONE = 1 << 12;
+
+int32_t to_fixed(float const v) {
+	return int32_t(std::floor(v * COLOR_MATRIX_ONE + 0.5f));
+}
+
 /*
  * originaly from http://beesbuzz.biz/code/hsv_color_transforms.php
  *
- * @param in: input
  * @param H hue shift (in degree)
  * @param S saturation multipiler (scaler)
  * @param V value multiplier (scaler)
  */
-void transform_hsv(Color& in, float const H,
-				   float const S, float const V) {
+color_matrix hsv_matrix(float const H, float const S, float const V) {
 	float const VSU = V * S * std::cos(H * PI / 180);
 	float const VSW = V * S * std::sin(H * PI / 180);
 
-	in = Color(
-		(.299*V+.701*VSU+.168*VSW)*in.red
-        + (.587*V-.587*VSU+.330*VSW)*in.green
-        + (.114*V-.114*VSU-.497*VSW)*in.blue,
-		(.299*V-.299*VSU-.328*VSW)*in.red
-        + (.587*V+.413*VSU+.035*VSW)*in.green
-        + (.114*V-.114*VSU+.292*VSW)*in.blue,
-		(.299*V-.3*VSU+1.25*VSW)*in.red
-        + (.587*V-.588*VSU-1.05*VSW)*in.green
-        + (.114*V+.886*VSU-.203*VSW)*in.blue,
-		in.alpha);
+	color_matrix const ret = { {
+			{ to_fixed(.299*V+.701*VSU+.168*VSW), to_fixed(.587*V-.587*VSU+.330*VSW), to_fixed(.114*V-.114*VSU-.497*VSW) },
+			{ to_fixed(.299*V-.299*VSU-.328*VSW), to_fixed(.587*V+.413*VSU+.035*VSW), to_fixed(.114*V-.114*VSU+.292*VSW) },
+			{ to_fixed(.299*V-.3*VSU+1.25*VSW), to_fixed(.587*V-.588*VSU-1.05*VSW), to_fixed(.114*V+.886*VSU-.203*VSW) } },
+		{ 0, 0, 0 } };
+	return ret;
+}
+
+// desaturates toward the luminance by tone.gray, then adds the tone
+color_matrix gray_tone_matrix(Tone const& t) {
+	float const factor = (255 - t.gray) / 255.f;
+	float const weight[3] = { 0.299f, 0.587f, 0.114f };
+	int const tone[3] = { t.red, t.green, t.blue };
+
+	color_matrix ret;
+	for(int i = 0; i < 3; ++i) {
+		for(int j = 0; j < 3; ++j) {
+			ret.m[i][j] = to_fixed(weight[j] * (1.f - factor) + (i == j? factor : 0.f));
+		}
+		ret.offset[i] = tone[i] * COLOR_MATRIX_ONE;
+	}
+	return ret;
+}
+
+inline uint8_t clamp_channel(int32_t const v) {
+	return uint8_t(std::max(0, std::min((v + COLOR_MATRIX_ONE / 2) >> 12, 0xff)));
+}
+
+void transform_color(Color& c, color_matrix const& mat) {
+	int32_t const in[3] = { c.red, c.green, c.blue };
+	uint8_t out[3];
+	for(int i = 0; i < 3; ++i) {
+		out[i] = clamp_channel(
+			mat.m[i][0] * in[0] + mat.m[i][1] * in[1] + mat.m[i][2] * in[2] + mat.offset[i]);
+	}
+	c.red = out[0];
+	c.green = out[1];
+	c.blue = out[2];
+}
+
+void transform_row(Color* row, size_t const len, color_matrix const& mat) {
+	size_t i = 0;
+#ifdef __SSE2__
+	__m128i const low_byte = _mm_set1_epi32(0xff);
+	__m128i const high_byte = _mm_set1_epi32(0x00ff0000);
+	__m128i const round = _mm_set1_epi32(COLOR_MATRIX_ONE / 2);
+	__m128i coef_rg[3], coef_b[3], offset[3];
+	for(int c = 0; c < 3; ++c) {
+		// shifted unsigned, the coefficients may be negative
+		coef_rg[c] = _mm_set1_epi32(int32_t(
+			(uint32_t(mat.m[c][0]) & 0xffff) | (uint32_t(mat.m[c][1]) << 16)));
+		coef_b[c] = _mm_set1_epi32(mat.m[c][2] & 0xffff);
+		offset[c] = _mm_set1_epi32(mat.offset[c]);
+	}
+
+	for(; i + 4 <= len; i += 4) {
+		__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row + i));
+
+		// (r, g) and (b, 0) pairs of 16 bit lanes
+		__m128i const rg = _mm_or_si128(
+			_mm_and_si128(v, low_byte), _mm_and_si128(_mm_slli_epi32(v, 8), high_byte));
+		__m128i const b = _mm_and_si128(_mm_srli_epi32(v, 16), low_byte);
+
+		__m128i res[3];
+		for(int c = 0; c < 3; ++c) {
+			res[c] = _mm_add_epi32(
+				_mm_add_epi32(_mm_madd_epi16(rg, coef_rg[c]), _mm_madd_epi16(b, coef_b[c])),
+				_mm_add_epi32(offset[c], round));
+			res[c] = _mm_srai_epi32(res[c], 12);
+		}
+
+		// planar RRRR GGGG BBBB AAAA, saturated to bytes
+		__m128i const planar = _mm_packus_epi16(
+			_mm_packs_epi32(res[0], res[1]),
+			_mm_packs_epi32(res[2], _mm_srli_epi32(v, 24)));
+
+		// back to RGBA
+		__m128i const rg_px = _mm_unpacklo_epi8(planar, _mm_srli_si128(planar, 4));
+		__m128i const ba_px = _mm_unpacklo_epi8(_mm_srli_si128(planar, 8), _mm_srli_si128(planar, 12));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_unpacklo_epi16(rg_px, ba_px));
+	}
+#endif
+	for(; i < len; ++i) { transform_color(row[i], mat); }
 }
 
 void color_tone_change(Color& in, Tone const& t) {
@@ -98,16 +190,33 @@ void color_tone_change(Color& in, Tone const& t) {
 	in.blue = std::max(0, std::min(in.blue + t.blue, 0xff));
 }
 
-void color_tone_change_gray(Color& in, Tone const& t, float const factor) {
-	assert(t.gray != 0);
-
-	float const gray = in.red * 0.299f + in.green * 0.587f + in.blue * 0.114f;
+// tone without gray is a saturated add/sub per channel
+void tone_change_row(Color* row, size_t const len, Tone const& t) {
+	assert(t.gray == 0);
 
-	in.red = std::max(0, std::min<int>((in.red - gray) * factor + gray + t.red + 0.5f, 255));
-	in.green = std::max(0, std::min<int>((in.green - gray) * factor + gray + t.green + 0.5f, 255));
-	in.blue = std::max(0, std::min<int>((in.blue - gray) * factor + gray + t.blue + 0.5f, 255));
+	size_t i = 0;
+#ifdef __SSE2__
+	Color const add(std::max(0, std::min(t.red, 0xff)),
+					std::max(0, std::min(t.green, 0xff)),
+					std::max(0, std::min(t.blue, 0xff)), 0);
+	Color const sub(std::max(0, std::min(-t.red, 0xff)),
+					std::max(0, std::min(-t.green, 0xff)),
+					std::max(0, std::min(-t.blue, 0xff)), 0);
+	int32_t add_v, sub_v;
+	std::memcpy(&add_v, &add, sizeof(add_v));
+	std::memcpy(&sub_v, &sub, sizeof(sub_v));
+	__m128i const add_vec = _mm_set1_epi32(add_v), sub_vec = _mm_set1_epi32(sub_v);
+
+	for(; i + 4 <= len; i += 4) {
+		__m128i* const p = reinterpret_cast<__m128i*>(row + i);
+		_mm_storeu_si128(p, _mm_subs_epu8(_mm_adds_epu8(_mm_loadu_si128(p), add_vec), sub_vec));
+	}
+#endif
+	for(; i < len; ++i) { color_tone_change(row[i], t); }
 }
 
+std::atomic<uint32_t> generation_counter(0);
+
 struct null_deleter { void operator()(void const*) const {} };
 
 struct pixman_releaser {
@@ -121,6 +230,8 @@ struct pixman_releaser {
 pixman_image_ptr create_color_mask(Color const& c) {
 	static Color const ignore_color(0, 0, 0, 255);
 
+	if(Player::current_vm()) { return Graphics().GetColorMask(c); }
+
 	pixman_color_t col = to_pixman(c);
 	return pixman_image_ptr(
 		c == ignore_color? NULL : pixman_image_create_solid_fill(&col),
@@ -128,9 +239,35 @@ pixman_image_ptr create_color_mask(Color const& c) {
 }
 
 pixman_image_ptr create_opacity_mask(int op) {
+	if(Player::current_vm()) { return Graphics().GetOpacityMask(op); }
+
 	return create_color_mask(Color(0, 0, 0, op));
 }
 
+// same rounding as pixman's MUL_UN8
+inline unsigned mul_un8(unsigned const a, unsigned const b) {
+	unsigned const t = a * b + 0x80;
+	return ((t >> 8) + t) >> 8;
+}
+
+// PIXMAN_OP_OVER without mask on one row
+void over_row(Color* dst, Color const* src, int const width) {
+	for(int i = 0; i < width; ++i) {
+		Color const& s = src[i];
+		Color& d = dst[i];
+
+		if(s.alpha == 0xff) {
+			d = s;
+		} else if(s.red | s.green | s.blue | s.alpha) {
+			unsigned const ia = 0xff - s.alpha;
+			d.red = std::min(0xffu, s.red + mul_un8(d.red, ia));
+			d.green = std::min(0xffu, s.green + mul_un8(d.green, ia));
+			d.blue = std::min(0xffu, s.blue + mul_un8(d.blue, ia));
+			d.alpha = std::min(0xffu, s.alpha + mul_un8(d.alpha, ia));
+		}
+	}
+}
+
 int waver_offset(int depth, double phase, int i) {
 	return depth * (1 + std::sin((phase + i * 20) * PI / 180));
 }
@@ -182,17 +319,26 @@ bool Bitmap::operator==(Bitmap const& rhs) const {
 }
 
 Bitmap::Bitmap(size_t w, size_t h, Color const& col)
-		: font(Font::Default()), dirty_(true)
+		: font(Font::Default()), dirty_(true), clipped_(false), generation_(++generation_counter)
 		, width_(w), height_(h), data_(w * h, col)
 		, ref_(create_image(width_, height_, data_.data(), width_ * 4))
 {}
 Bitmap::Bitmap(Bitmap const& src)
-		: font(src.font), dirty_(true)
+		: font(src.font), dirty_(true), clipped_(false), generation_(++generation_counter)
 		, width_(src.width_), height_(src.height_)
 		, data_(src.data_)
 		, ref_(create_image(width_, height_, data_.data(), width_ * 4))
 {}
 
+Bitmap::Bitmap(ImageIO::Image& img)
+		: font(Font::Default()), dirty_(true), clipped_(false), generation_(++generation_counter)
+		, width_(img.width), height_(img.height)
+		, data_(std::move(img.pixels))
+		, ref_(create_image(width_, height_, data_.data(), width_ * 4))
+{
+	assert(data_.size() == width_ * height_);
+}
+
 size_t Bitmap::width() const {
 	assert(size_t(pixman_image_get_width(ref_.get())) == width_);
 	return width_;
@@ -215,6 +361,9 @@ BitmapRef Bitmap::Create(size_t width, size_t height, Color const& col) {
 BitmapRef Bitmap::Create(BitmapRef const& another) {
 	return BitmapRef(new Bitmap(*another));
 }
+BitmapRef Bitmap::Create(ImageIO::Image& img) {
+	return BitmapRef(new Bitmap(img));
+}
 BitmapRef Bitmap::Create(uint8_t const* data, size_t data_size, bool transparent) {
 	static char const XYZ_SIGNATURE[] = "XYZ1";
 	static char const BMP_SIGNATURE[] = "BM";
@@ -258,8 +407,13 @@ bool Bitmap::clear_dirty_flag() {
 	return ret;
 }
 
+uint32_t Bitmap::generation() const {
+	return generation_;
+}
+
 void Bitmap::mark_dirty() {
 	dirty_ = true;
+	generation_ = ++generation_counter;
 }
 
 void Bitmap::pixman_image_composite(pixman_image_ptr const& src,
@@ -295,6 +449,11 @@ Color const& Bitmap::get_pixel(int const x, int const y) const {
 	return inside_image(*this, x, y)? data_[width_ * y + x] : INVALID;
 }
 
+Color const* Bitmap::row(int const y) const {
+	assert(0 <= y and size_t(y) < height_);
+	return data_.data() + width_ * y;
+}
+
 void Bitmap::set_pixel(int const x, int const y, Color const& col) {
 	if(inside_image(*this, x, y)) {
 		data_[width_ * y + x] = col;
@@ -303,8 +462,7 @@ void Bitmap::set_pixel(int const x, int const y, Color const& col) {
 }
 
 void Bitmap::hue_change(int hue) {
-	std::for_each(data_.begin(), data_.end(),
-				  boost::bind(&transform_hsv, _1, hue, 1.f, 1.f));
+	transform_row(data_.data(), data_.size(), hsv_matrix(hue, 1.f, 1.f));
 
 	mark_dirty();
 }
@@ -352,12 +510,40 @@ void Bitmap::draw_text(Rect const& rect, std::string const& str, int color, Text
 void Bitmap::blit(int x, int y, Bitmap const& src, Rect const& src_rect, int opacity) {
 	check_opacity(opacity);
 
+	if(opacity == 255 and &src != this and not clipped_) {
+		over_blit(x, y, src, src_rect);
+		return;
+	}
+
 	pixman_image_composite(
 		src.ref_, create_opacity_mask(opacity),
 		src_rect.x, src_rect.y, 0, 0, x, y,
 		src_rect.width, src_rect.height);
 }
 
+void Bitmap::over_blit(int x, int y, Bitmap const& src, Rect const& src_rect) {
+	assert(&src != this);
+
+	if(clipped_) {
+		pixman_image_composite(
+			src.ref_, pixman_image_ptr(),
+			src_rect.x, src_rect.y, 0, 0, x, y,
+			src_rect.width, src_rect.height);
+		return;
+	}
+
+	Rect src_r = src_rect, dst_r(x, y, 0, 0);
+	if(not Rect::AdjustRectangles(src_r, dst_r, src.rect())) { return; }
+	if(not Rect::AdjustRectangles(dst_r, src_r, rect())) { return; }
+
+	for(int i = 0; i < dst_r.height; ++i) {
+		over_row(&data_[width_ * (dst_r.y + i) + dst_r.x],
+				 &src.data_[src.width_ * (src_r.y + i) + src_r.x], dst_r.width);
+	}
+
+	mark_dirty();
+}
+
 BitmapRef Bitmap::waver(int const depth, double const phase, Rect const& rect) const {
 	if(depth == 0) { return sub_image(rect); }
 	BitmapRef const ret = Bitmap::Create(rect.width + waver_offset_max(depth), rect.height);
@@ -387,12 +573,10 @@ void Bitmap::waver_blit(BlitCommon const& info, int depth, double phase, int opa
 
 BitmapRef Bitmap::tone_change(Tone const& tone, Rect const& r) const {
 	BitmapRef const ret = sub_image(r);
-	if(tone != Tone()) {
-		std::for_each(ret->data_.begin(), ret->data_.end(),
-					  tone.gray == 0
-					  ? boost::function<void(Color&)>(boost::bind(&color_tone_change, _1, boost::cref(tone)))
-					  : boost::function<void(Color&)>(boost::bind(
-						  &color_tone_change_gray, _1, boost::cref(tone), (255 - tone.gray) / 255.f)));
+	if(tone.gray != 0) {
+		transform_row(ret->data_.data(), ret->data_.size(), gray_tone_matrix(tone));
+	} else if(tone != Tone()) {
+		tone_change_row(ret->data_.data(), ret->data_.size(), tone);
 	}
 	return ret;
 }
@@ -512,6 +696,33 @@ void Bitmap::clear() {
 
 	mark_dirty();
 }
+void Bitmap::clear(Rect const& rect) {
+	pixman_color_t c = to_pixman(Color(0, 0, 0, 0));
+	pixman_rectangle16_t const r = to_pixman(rect);
+	pixman_image_fill_rectangles(PIXMAN_OP_CLEAR, ref_.get(), &c, 1, &r);
+
+	mark_dirty();
+}
+
+void Bitmap::set_clip_rects(std::vector<Rect> const& rects) {
+	clipped_ = not rects.empty();
+	if(not clipped_) {
+		pixman_image_set_clip_region32(ref_.get(), NULL);
+		return;
+	}
+
+	std::vector<pixman_box32_t> boxes(rects.size());
+	for(size_t i = 0; i < rects.size(); ++i) {
+		Rect const& r = rects[i];
+		pixman_box32_t const box = { r.x, r.y, r.x + r.width, r.y + r.height };
+		boxes[i] = box;
+	}
+
+	pixman_region32_t region;
+	pixman_region32_init_rects(&region, boxes.data(), boxes.size());
+	pixman_image_set_clip_region32(ref_.get(), &region);
+	pixman_region32_fini(&region);
+}
 
 void Bitmap::transform_blit(BlitCommon const& info, Matrix const& mat, int opacity) {
 	check_opacity(opacity);
@@ -548,8 +759,9 @@ void Bitmap::effect_blit(BlitCommon const& info, Matrix const& mat,
 				info.src_rect.width, top_height)),
 			mat, top_opacity);
 
+		Rect const offset = mat.transform(Rect(0, top_height, 0, 0));
 		transform_blit(
-			BlitCommon(info.x, info.y, info.src, Rect(
+			BlitCommon(info.x + offset.x, info.y + offset.y, info.src, Rect(
 				info.src_rect.x, info.src_rect.y + top_height,
 				info.src_rect.width, opacity_split)),
 			mat, bottom_opacity);
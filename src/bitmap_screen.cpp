@@ -22,6 +22,10 @@
 #include "bitmap_screen.h"
 #include "bitmap.h"
 #include "graphics.h"
+#include "cache.h"
+#include "drawable.h"
+
+#include <boost/functional/hash.hpp>
 
 BitmapScreenRef BitmapScreen::Create(BitmapRef const& source) {
 	return std::make_shared<BitmapScreen>(source);
@@ -127,6 +131,48 @@ void BitmapScreen::BlitScreenTiled(Rect const& src_rect, Rect const& dst_rect, i
 	}
 }
 
+void BitmapScreen::GetDrawState(int x, int y, Rect const& src_rect, DrawState& state) const {
+	if (not bitmap || (opacity_top_effect <= 0 && opacity_bottom_effect <= 0))
+		return;
+
+	Rect const rect = src_rect_effect.GetSubRect(src_rect);
+	AddDrawState(Rect(x, y, rect.width, rect.height), x, y, rect, state);
+}
+
+void BitmapScreen::GetDrawStateTiled(Rect const& src_rect, Rect const& dst_rect, int ox, int oy, DrawState& state) const {
+	if (not bitmap || (opacity_top_effect <= 0 && opacity_bottom_effect <= 0))
+		return;
+
+	AddDrawState(dst_rect, ox, oy, src_rect_effect.GetSubRect(src_rect), state);
+}
+
+void BitmapScreen::AddDrawState(Rect const& dst_rect, int x, int y, Rect const& src_rect, DrawState& state) const {
+	bool const transformed = zoom_x_effect != 1.0 || zoom_y_effect != 1.0 ||
+		angle_effect != 0.0 || waver_effect_depth != 0;
+
+	size_t seed = 0;
+	boost::hash_combine(seed, bitmap.get());
+	boost::hash_combine(seed, bitmap->generation());
+	boost::hash_combine(seed, x);
+	boost::hash_combine(seed, y);
+	int const rect_values[] = { src_rect.x, src_rect.y, src_rect.width, src_rect.height };
+	boost::hash_range(seed, rect_values, rect_values + 4);
+
+	int const effect_values[] = {
+		opacity_top_effect, opacity_bottom_effect, bush_effect,
+		tone_effect.red, tone_effect.green, tone_effect.blue, tone_effect.gray,
+		flash_effect.red, flash_effect.green, flash_effect.blue, flash_effect.alpha,
+		flipx_effect, flipy_effect, waver_effect_depth };
+	boost::hash_range(seed, effect_values, effect_values + 14);
+	boost::hash_combine(seed, zoom_x_effect);
+	boost::hash_combine(seed, zoom_y_effect);
+	boost::hash_combine(seed, angle_effect);
+	boost::hash_combine(seed, waver_effect_phase);
+
+	// transformed draws may cover anything
+	state.Add(transformed ? Graphics().ScreenBuffer()->rect() : dst_rect, seed);
+}
+
 void BitmapScreen::SetDirty() {
 	needs_refresh = true;
 	bitmap_changed = true;
@@ -323,6 +369,24 @@ void BitmapScreen::BlitScreenIntern(BitmapRef const& draw_bitmap, int x, int y,
 	double zoom_x = need_scale ? zoom_x_effect : 1.0;
 	double zoom_y = need_scale ? zoom_y_effect : 1.0;
 
+	// translation only: skip the matrix setup
+	if (zoom_x == 1.0 && zoom_y == 1.0 && angle_effect == 0.0 && waver_effect_depth == 0) {
+		if (opacity_split <= 0 || opacity_top_effect == opacity_bottom_effect) {
+			dst->blit(x, y, *draw_bitmap, src_rect, opacity_top_effect);
+		} else if (opacity_split >= src_rect.height) {
+			dst->blit(x, y, *draw_bitmap, src_rect, opacity_bottom_effect);
+		} else {
+			int const top_height = src_rect.height - opacity_split;
+			dst->blit(x, y, *draw_bitmap,
+					  Rect(src_rect.x, src_rect.y, src_rect.width, top_height),
+					  opacity_top_effect);
+			dst->blit(x, y + top_height, *draw_bitmap,
+					  Rect(src_rect.x, src_rect.y + top_height, src_rect.width, opacity_split),
+					  opacity_bottom_effect);
+		}
+		return;
+	}
+
 	dst->effect_blit(BlitCommon(x, y, *draw_bitmap, src_rect),
 					 opacity_top_effect, opacity_bottom_effect, opacity_split,
 					 Tone(), zoom_x, zoom_y, angle_effect * 3.14159 / 180,
@@ -371,40 +435,25 @@ BitmapRef BitmapScreen::Refresh(Rect& rect, bool& need_scale, int& bush_y) {
 		current_flip_x = flipx_effect;
 		current_flip_y = flipy_effect;
 
-		if (bitmap_effects &&
-			int(bitmap_effects->width()) < rect.x + rect.width &&
-			int(bitmap_effects->height()) < rect.y + rect.height) {
-			bitmap_effects.reset();
-		}
-
-		if (!bitmap_effects)
-			bitmap_effects = Bitmap::Create(bitmap->width(), bitmap->height());
-
-		bitmap_effects->clear();
-
-		BlitCommon const common(rect.x, rect.y, *bitmap, rect);
-		if (no_tone && no_flash)
-			bitmap_effects->flip_blit(common, flipx_effect, flipy_effect);
-		else if (no_flip && no_flash)
-			bitmap_effects->tone_blit(common, tone_effect);
-		else if (no_flip && no_tone)
-			bitmap_effects->blend_blit(common, flash_effect);
-		else if (no_flash) {
-			bitmap_effects->tone_blit(common, tone_effect);
-			bitmap_effects->flip(rect, flipx_effect, flipy_effect);
-		}
-		else if (no_tone) {
-			bitmap_effects->blend_blit(common, flash_effect);
-			bitmap_effects->flip(rect, flipx_effect, flipy_effect);
-		}
-		else if (no_flip) {
-			bitmap_effects->blend_blit(common, flash_effect);
-			bitmap_effects->tone_blit(BlitCommon(rect.x, rect.y, *bitmap_effects, rect), tone_effect);
-		}
-		else {
-			bitmap_effects->blend_blit(common, flash_effect);
-			bitmap_effects->tone_blit(BlitCommon(rect.x, rect.y, *bitmap_effects, rect), tone_effect);
-			bitmap_effects->flip(rect, flipx_effect, flipy_effect);
+		Cache_::EffectKey const key = {
+			bitmap.get(), bitmap->generation(), rect,
+			tone_effect, flash_effect, flipx_effect, flipy_effect, 1.0, 1.0 };
+		Cache_::EffectKey sheet_key = key;
+		sheet_key.rect = bitmap->rect();
+
+		// tone and flash don't depend on the rect: once reused, share them for the whole source
+		bool const share = no_flip && rect != sheet_key.rect;
+		bitmap_effects = share ? Cache().Effect(sheet_key) : BitmapRef();
+		if (!bitmap_effects) {
+			bitmap_effects = Cache().Effect(key);
+			if (!bitmap_effects) {
+				// only the drawn rect, fading effects are never used again
+				bitmap_effects = CreateEffects(rect);
+				Cache().AddEffect(key, bitmap_effects);
+			} else if (share) {
+				bitmap_effects = CreateEffects(sheet_key.rect);
+				Cache().AddEffect(sheet_key, bitmap_effects);
+			}
 		}
 
 		bitmap_effects_src_rect = rect;
@@ -442,9 +491,15 @@ BitmapRef BitmapScreen::Refresh(Rect& rect, bool& need_scale, int& bush_y) {
 	current_zoom_x = zoom_x_effect;
 	current_zoom_y = zoom_y_effect;
 
-	bitmap_scale.reset();
+	Cache_::EffectKey const key = {
+		src_bitmap.get(), src_bitmap->generation(), rect,
+		Tone(), Color(0, 0, 0, 0), false, false, zoom_x_effect, zoom_y_effect };
 
-	bitmap_scale = src_bitmap->resample(zoomed_width, zoomed_height, rect);
+	bitmap_scale = Cache().Effect(key);
+	if (!bitmap_scale) {
+		bitmap_scale = src_bitmap->resample(zoomed_width, zoomed_height, rect);
+		Cache().AddEffect(key, bitmap_scale);
+	}
 
 	bitmap_scale_src_rect = rect;
 	bitmap_scale_valid = true;
@@ -453,3 +508,39 @@ BitmapRef BitmapScreen::Refresh(Rect& rect, bool& need_scale, int& bush_y) {
 	rect = bitmap_scale->rect();
 	return bitmap_scale;
 }
+
+BitmapRef BitmapScreen::CreateEffects(Rect const& rect) const {
+	bool no_tone = tone_effect == Tone();
+	bool no_flash = flash_effect.alpha == 0;
+	bool no_flip = !flipx_effect && !flipy_effect;
+
+	// shared through the cache: always a new bitmap
+	BitmapRef const ret = Bitmap::Create(bitmap->width(), bitmap->height());
+
+	BlitCommon const common(rect.x, rect.y, *bitmap, rect);
+	if (no_tone && no_flash)
+		ret->flip_blit(common, flipx_effect, flipy_effect);
+	else if (no_flip && no_flash)
+		ret->tone_blit(common, tone_effect);
+	else if (no_flip && no_tone)
+		ret->blend_blit(common, flash_effect);
+	else if (no_flash) {
+		ret->tone_blit(common, tone_effect);
+		ret->flip(rect, flipx_effect, flipy_effect);
+	}
+	else if (no_tone) {
+		ret->blend_blit(common, flash_effect);
+		ret->flip(rect, flipx_effect, flipy_effect);
+	}
+	else if (no_flip) {
+		ret->blend_blit(common, flash_effect);
+		ret->tone_blit(BlitCommon(rect.x, rect.y, *ret, rect), tone_effect);
+	}
+	else {
+		ret->blend_blit(common, flash_effect);
+		ret->tone_blit(BlitCommon(rect.x, rect.y, *ret, rect), tone_effect);
+		ret->flip(rect, flipx_effect, flipy_effect);
+	}
+
+	return ret;
+}
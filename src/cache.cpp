@@ -20,7 +20,12 @@
 #  pragma warning(disable: 4003)
 #endif
 
+#include <algorithm>
+#include <condition_variable>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
 
 #include <boost/format.hpp>
 #include <boost/preprocessor/seq/for_each.hpp>
@@ -29,9 +34,130 @@
 #include "cache.h"
 #include "filefinder.h"
 #include "bitmap.h"
+#include "image_io.h"
 #include "output.h"
 #include "player.h"
 
+namespace {
+
+/** Memory limit of the shared effect bitmaps in bytes. */
+size_t const EFFECT_CACHE_SIZE = 32 * 1024 * 1024;
+
+size_t bitmap_size(BitmapRef const& bmp) {
+	return bmp->width() * bmp->height() * sizeof(Color);
+}
+
+/** Prefetched images kept at most before taken. */
+size_t const PREFETCH_LIMIT = 64;
+
+}
+
+/**
+ * Image decoded by a worker.
+ * Everything but the fields set at creation is guarded by the decoder mutex.
+ */
+struct Cache_::Job {
+	Job(std::string const& p, bool t)
+			: path(p), transparent(t), done(false), decoded(false) {}
+
+	std::string const path;
+	bool const transparent;
+	bool done;
+	bool decoded;
+	ImageIO::Image image;
+};
+
+/**
+ * Worker threads decoding prefetched images.
+ * Workers only touch their job, so no VM call happens off the main thread.
+ */
+struct Cache_::Decoder : boost::noncopyable {
+	Decoder() : quit(false) {
+		// leave a core to the main thread
+		unsigned const threads = std::min(2U, std::max(2U, std::thread::hardware_concurrency()) - 1);
+		for (unsigned i = 0; i < threads; ++i) {
+			workers.push_back(std::thread(&Decoder::Work, this));
+		}
+	}
+
+	~Decoder() {
+		{
+			std::lock_guard<std::mutex> const lock(mutex);
+			quit = true;
+		}
+		queued.notify_all();
+		for (size_t i = 0; i < workers.size(); ++i) { workers[i].join(); }
+	}
+
+	void Push(JobRef const& job) {
+		{
+			std::lock_guard<std::mutex> const lock(mutex);
+			queue.push_back(job);
+		}
+		queued.notify_one();
+	}
+
+	bool Done(Job const& job) {
+		std::lock_guard<std::mutex> const lock(mutex);
+		return job.done;
+	}
+
+	void Wait(Job const& job) {
+		std::unique_lock<std::mutex> lock(mutex);
+		finished.wait(lock, [&job] { return job.done; });
+	}
+
+	/**
+	 * Drops job when it is still queued, it is finished as not decoded.
+	 * A job being decoded can't be stopped and finishes as usual.
+	 */
+	void Cancel(JobRef const& job) {
+		{
+			std::lock_guard<std::mutex> const lock(mutex);
+			std::deque<JobRef>::iterator const it = std::find(queue.begin(), queue.end(), job);
+			if (it == queue.end()) { return; }
+			job->done = true;
+			queue.erase(it);
+		}
+		finished.notify_all();
+	}
+
+	/** Drops queued jobs, they are finished as not decoded. */
+	void Cancel() {
+		{
+			std::lock_guard<std::mutex> const lock(mutex);
+			for (size_t i = 0; i < queue.size(); ++i) { queue[i]->done = true; }
+			queue.clear();
+		}
+		finished.notify_all();
+	}
+
+	void Work() {
+		std::unique_lock<std::mutex> lock(mutex);
+		for (;;) {
+			queued.wait(lock, [this] { return quit || !queue.empty(); });
+			if (quit) { return; }
+
+			JobRef const job = queue.front();
+			queue.pop_front();
+
+			lock.unlock();
+			bool const decoded = ImageIO::DecodeImage(job->path, job->transparent, job->image);
+			lock.lock();
+
+			job->decoded = decoded;
+			job->done = true;
+			finished.notify_all();
+		}
+	}
+
+	std::mutex mutex;
+	std::condition_variable queued, finished;
+	std::deque<JobRef> queue;
+	bool quit;
+	std::vector<std::thread> workers;
+};
+
 struct Cache_::Spec {
 	char const* directory;
 	bool transparent;
@@ -58,11 +184,24 @@ Cache_::Spec const Cache_::specs_[] = {
 	{ "Frame", true, 320, 320, 240, 240 },
 };
 
+Cache_::Cache_()
+		: effects_size(0)
+		, effect_hits(0)
+		, effect_misses(0)
+{}
+
+Cache_::~Cache_() {}
+
 template<Cache_::Material::Type T>
 BitmapRef Cache_::LoadBitmap(std::string const& f) {
 	BOOST_STATIC_ASSERT(Material::REND < T && T < Material::END);
+	return LoadBitmap(T, f);
+}
+
+BitmapRef Cache_::LoadBitmap(Material::Type const type, std::string const& f) {
+	assert(Material::REND < type && type < Material::END);
 
-	Spec const& s = specs_[T];
+	Spec const& s = specs_[type];
 	BitmapRef const ret = LoadBitmap(s, f);
 
 	if(ret->width () < s.min_width  || s.max_width  < ret->width () ||
@@ -81,6 +220,10 @@ BitmapRef Cache_::LoadBitmap(Spec const& spec, std::string const& filename) {
 	cache_type::const_iterator const it = cache.find(key);
 
 	if (it == cache.end() || it->second.expired()) {
+		if (BitmapRef const prefetched = TakePrefetched(key)) {
+			return (cache[key] = prefetched).lock();
+		}
+
 		std::string const path = FileFinder().FindImage(spec.directory, filename);
 
 		if (path.empty()) {
@@ -98,6 +241,69 @@ BitmapRef Cache_::LoadBitmap(Spec const& spec, std::string const& filename) {
 	} else { return it->second.lock(); }
 }
 
+BitmapRef Cache_::TakePrefetched(string_pair const& key) {
+	prefetches_type::iterator const it = prefetches.find(key);
+	if (it == prefetches.end()) { return BitmapRef(); }
+
+	JobRef const job = it->second;
+	prefetches.erase(it);
+	prefetch_order.erase(std::find(prefetch_order.begin(), prefetch_order.end(), key));
+
+	decoder->Wait(*job);
+	// failures are reported by the synchronous load
+	return job->decoded? Bitmap::Create(job->image) : BitmapRef();
+}
+
+Cache_::Prefetched::Prefetched(Cache_& c, Material::Type t, std::string const& f)
+		: cache(&c), type(t), filename(f) {}
+
+bool Cache_::Prefetched::Ready() const {
+	return !job || cache->decoder->Done(*job);
+}
+
+BitmapRef Cache_::Prefetched::Get() const {
+	return cache->LoadBitmap(type, filename);
+}
+
+Cache_::Prefetched Cache_::Prefetch(Material::Type const type, std::string const& filename) {
+	assert(Material::REND < type && type < Material::END);
+
+	Prefetched ret(*this, type, filename);
+	if (filename.empty()) { return ret; }
+
+	Spec const& spec = specs_[type];
+	string_pair const key(spec.directory, filename);
+
+	cache_type::const_iterator const cached = cache.find(key);
+	if (cached != cache.end() && !cached->second.expired()) { return ret; }
+
+	prefetches_type::const_iterator const queued = prefetches.find(key);
+	if (queued != prefetches.end()) {
+		ret.job = queued->second;
+		return ret;
+	}
+
+	std::string const path = FileFinder().FindImage(spec.directory, filename);
+	// reported when requested
+	if (path.empty()) { return ret; }
+
+	if (!decoder) { decoder.reset(new Decoder()); }
+
+	if (prefetches.size() >= PREFETCH_LIMIT) {
+		// never requested, likely stale
+		prefetches_type::iterator const stale = prefetches.find(prefetch_order.front());
+		decoder->Cancel(stale->second);
+		prefetches.erase(stale);
+		prefetch_order.pop_front();
+	}
+
+	ret.job = std::make_shared<Job>(path, spec.transparent);
+	prefetches[key] = ret.job;
+	prefetch_order.push_back(key);
+	decoder->Push(ret.job);
+	return ret;
+}
+
 #define macro(r, data, elem)						\
 	BitmapRef Cache_::elem(const std::string& f) {	\
 		return LoadBitmap<Material::elem>(f);		\
@@ -158,4 +364,79 @@ void Cache_::Clear() {
 					   % i->first.first % i->first.second);
 	}
 	cache_tiles.clear();
+
+	if (decoder) { decoder->Cancel(); }
+	prefetches.clear();
+	prefetch_order.clear();
+
+	cache_effects.clear();
+	effects_lru.clear();
+	effects_size = 0;
+}
+
+namespace {
+
+// entries of the same source area are adjacent in cache_effects
+bool same_effect_area(Cache_::EffectKey const& lhs, Cache_::EffectKey const& rhs) {
+	return lhs.source == rhs.source && lhs.rect == rhs.rect;
+}
+
+}
+
+bool Cache_::EffectKey::operator<(EffectKey const& rhs) const {
+	return
+			std::tie(source, rect.x, rect.y, rect.width, rect.height, generation,
+					 tone.red, tone.green, tone.blue, tone.gray,
+					 flash.red, flash.green, flash.blue, flash.alpha,
+					 flip_x, flip_y, zoom_x, zoom_y)
+			< std::tie(rhs.source, rhs.rect.x, rhs.rect.y, rhs.rect.width, rhs.rect.height, rhs.generation,
+					   rhs.tone.red, rhs.tone.green, rhs.tone.blue, rhs.tone.gray,
+					   rhs.flash.red, rhs.flash.green, rhs.flash.blue, rhs.flash.alpha,
+					   rhs.flip_x, rhs.flip_y, rhs.zoom_x, rhs.zoom_y);
+}
+
+BitmapRef Cache_::Effect(EffectKey const& key) {
+	cache_effects_type::const_iterator const it = cache_effects.find(key);
+	if (it == cache_effects.end()) {
+		++effect_misses;
+		return BitmapRef();
+	}
+
+	++effect_hits;
+	// move to most recently used
+	effects_lru.splice(effects_lru.begin(), effects_lru, it->second);
+	return it->second->second;
+}
+
+void Cache_::AddEffect(EffectKey const& key, BitmapRef const& bmp) {
+	/*
+	 * replace the entries of an older generation or other effects on the same area.
+	 * fades change the tone every frame and would fill the cache with entries never hit again.
+	 */
+	cache_effects_type::iterator first = cache_effects.lower_bound(key), last = first;
+	while (first != cache_effects.begin() && same_effect_area((first - 1)->first, key)) { --first; }
+	while (last != cache_effects.end() && same_effect_area(last->first, key)) { ++last; }
+	for (cache_effects_type::iterator i = first; i != last; ++i) {
+		effects_size -= bitmap_size(i->second->second);
+		effects_lru.erase(i->second);
+	}
+	cache_effects.erase(first, last);
+
+	effects_lru.push_front(std::make_pair(key, bmp));
+	cache_effects[key] = effects_lru.begin();
+	effects_size += bitmap_size(bmp);
+
+	while (effects_size > EFFECT_CACHE_SIZE && effects_lru.size() > 1) {
+		effects_size -= bitmap_size(effects_lru.back().second);
+		cache_effects.erase(effects_lru.back().first);
+		effects_lru.pop_back();
+	}
+}
+
+unsigned Cache_::GetEffectHits() const {
+	return effect_hits;
+}
+
+unsigned Cache_::GetEffectMisses() const {
+	return effect_misses;
 }
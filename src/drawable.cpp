@@ -1,6 +1,24 @@
 #include "drawable.h"
 #include "graphics.h"
 
+#include <algorithm>
+
+#include <boost/functional/hash.hpp>
+
+DrawState::DrawState() : signature(0) {}
+
+void DrawState::Add(Rect const& nrect, size_t nsignature) {
+	if (rect.IsEmpty()) {
+		rect = nrect;
+	} else if (!nrect.IsEmpty()) {
+		int const x0 = std::min(rect.x, nrect.x), y0 = std::min(rect.y, nrect.y);
+		int const x1 = std::max(rect.x + rect.width, nrect.x + nrect.width);
+		int const y1 = std::max(rect.y + rect.height, nrect.y + nrect.height);
+		rect = Rect(x0, y0, x1 - x0, y1 - y0);
+	}
+	boost::hash_combine(signature, nsignature);
+}
+
 Drawable::Drawable(Drawable::Type const t)
 		: type(t), ID(Graphics().drawable_id++)
 		, visible(true) {}
@@ -16,9 +16,13 @@
  */
 
 // Headers
+#include <algorithm>
+#include <cctype>
+#include <list>
 #include <map>
 #include <ciso646>
 
+#include <boost/container/flat_map.hpp>
 #include <boost/format.hpp>
 #include <boost/next_prior.hpp>
 #include <boost/regex/pending/unicode_iterator.hpp>
@@ -59,6 +63,110 @@ namespace {
 		}
 	}
 
+	/*
+	 * glyphs rendered once with their shadow and colors into a shared page
+	 * and blitted from there instead of drawn pixel by pixel.
+	 * a full page is cleared and filled again.
+	 */
+	struct GlyphAtlas {
+		enum { PAGE_SIZE = 256 };
+
+		GlyphAtlas() : next_x_(0), next_y_(0), row_height_(0), stamp_(0) {}
+
+		/*
+		 * clears the glyphs when what they were rendered from changed
+		 *
+		 * @param stamp e.g. generation of the system graphic
+		 */
+		void Validate(uint32_t const stamp) {
+			if(stamp != stamp_) {
+				Clear();
+				stamp_ = stamp;
+			}
+		}
+
+		bool Find(unsigned const glyph, Rect& ret) const {
+			glyphs_type::const_iterator const i = glyphs_.find(glyph);
+			return i == glyphs_.end()? false : (ret = i->second, true);
+		}
+
+		/*
+		 * reserves an area for glyph on the page
+		 *
+		 * @param ret area to render the glyph into
+		 * @return false if the glyph is larger than a page
+		 */
+		bool Add(unsigned const glyph, int const width, int const height, Rect& ret) {
+			if(width > PAGE_SIZE or height > PAGE_SIZE) { return false; }
+			if(not page_) { page_ = Bitmap::Create(PAGE_SIZE, PAGE_SIZE); }
+
+			if(next_x_ + width > PAGE_SIZE) {
+				next_x_ = 0;
+				next_y_ += row_height_;
+				row_height_ = 0;
+			}
+			if(next_y_ + height > PAGE_SIZE) { Clear(); }
+
+			ret = glyphs_[glyph] = Rect(next_x_, next_y_, width, height);
+			next_x_ += width;
+			row_height_ = std::max(row_height_, height);
+			return true;
+		}
+
+		void Clear() {
+			glyphs_.clear();
+			next_x_ = next_y_ = row_height_ = 0;
+			if(page_) { page_->clear(); }
+		}
+
+		Bitmap& page() { return *page_; }
+
+	private:
+		typedef boost::container::flat_map<unsigned, Rect> glyphs_type;
+		glyphs_type glyphs_;
+		BitmapRef page_;
+		int next_x_, next_y_, row_height_;
+		uint32_t stamp_;
+	};
+
+	uint32_t color_stamp(Color const& c) {
+		return (uint32_t(c.red) << 24) | (c.green << 16) | (c.blue << 8) | c.alpha;
+	}
+
+	/*
+	 * atlases of the glyphs drawn in Font::default_color, one per color.
+	 * the least recently used one is reused for a new color so
+	 * switching between a few colors doesn't clear the glyphs.
+	 */
+	struct ColorAtlases {
+		enum { LIMIT = 4 };
+
+		GlyphAtlas& Get(Color const& c) {
+			uint32_t const stamp = color_stamp(c);
+			atlases_type::iterator i = atlases_.begin();
+			for(; i != atlases_.end() and i->first != stamp; ++i);
+
+			if(i == atlases_.end()) {
+				if(atlases_.size() < LIMIT) {
+					i = atlases_.insert(atlases_.end(), atlases_type::value_type());
+				} else {
+					i = boost::prior(atlases_.end());
+				}
+				i->first = stamp;
+				i->second.Validate(stamp);
+			}
+			atlases_.splice(atlases_.begin(), atlases_, i);
+			return i->second;
+		}
+
+		void Clear() { atlases_.clear(); }
+
+	private:
+		// most recently used first
+		typedef std::list<std::pair<uint32_t, GlyphAtlas> > atlases_type;
+		atlases_type atlases_;
+	};
+
 	ShinonomeGlyph const* find_gothic_glyph(uint32_t code) {
 		return find_glyph<sizeof(SHINONOME_GOTHIC) / sizeof(ShinonomeGlyph)>
 				(SHINONOME_GOTHIC, code);
@@ -84,11 +192,16 @@ namespace {
 		Rect GetSize(unsigned glyph) const;
 
 		void Render(Bitmap& bmp, int x, int y, Bitmap const& sys, int color, unsigned glyph);
-		void Render(Bitmap& bmp, int x, int y, Bitmap const& sys, int color, ShinonomeGlyph const& g);
 		void Render(Bitmap& bmp, int x, int y, unsigned glyph);
 
 	private:
+		void Rasterize(Bitmap& bmp, int x, int y, Bitmap const& sys, int color, ShinonomeGlyph const& g);
+		void Rasterize(Bitmap& bmp, int x, int y, ShinonomeGlyph const& g);
+
 		function_type const func_;
+		// by system color, default_color ones in plain_atlases_
+		std::map<int, GlyphAtlas> atlases_;
+		ColorAtlases plain_atlases_;
 	}; // class ShinonomeFont
 
 
@@ -118,8 +231,11 @@ namespace {
 		std::shared_ptr<boost::remove_pointer<FT_Face>::type> face_;
 		std::string face_name_;
 		unsigned current_size_;
+		// cleared when the face or its size changes
+		ColorAtlases atlases_;
 
 		bool check_face();
+		bool load_glyph(unsigned glyph);
 	}; // class FTFont
 
 	FontRef const gothic = std::make_shared<ShinonomeFont>(&find_gothic_glyph);
@@ -133,27 +249,101 @@ namespace {
 
 Color Font::default_color(255, 255, 255, 255);
 
-Rect Font::GetSize(std::string const& non_nfc_txt) const {
-	std::string const txt = Utils::ToNfcString(non_nfc_txt);
-	typedef boost::u8_to_u32_iterator<std::string::const_iterator> iterator;
-	iterator i(txt.begin(), txt.begin(), txt.end());
-	iterator const end(txt.end(), txt.begin(), txt.end());
+struct Font::LayoutCache {
+	typedef std::list<std::pair<std::string, LayoutRef> > list_type;
+	typedef std::map<std::string, list_type::iterator> index_type;
+
+	LayoutCache() : size(0) {}
+
+	// least recently used at the back
+	list_type lru;
+	index_type index;
+	// layouts depend on the pixel size of the font
+	unsigned size;
+};
+
+namespace {
+
+bool is_ascii(std::string const& str) {
+	return std::find_if(str.begin(), str.end(), [](char c) { return c & 0x80; }) == str.end();
+}
+
+bool is_exfont(uint32_t const c) {
+	return c < 0x80 and std::isalpha(c);
+}
+
+Font::Layout create_layout(Font const& font, std::string const& non_nfc_txt) {
+	std::vector<uint32_t> codes;
+	// ASCII is always in NFC
+	if(is_ascii(non_nfc_txt)) {
+		codes.assign(non_nfc_txt.begin(), non_nfc_txt.end());
+	} else {
+		std::string const txt = Utils::ToNfcString(non_nfc_txt);
+		typedef boost::u8_to_u32_iterator<std::string::const_iterator> iterator;
+		codes.assign(iterator(txt.begin(), txt.begin(), txt.end()),
+					 iterator(txt.end(), txt.begin(), txt.end()));
+	}
 
-	Rect ret;
+	Font::Layout ret;
+	size_t const pixel_size = font.pixel_size();
 
-	for(; i != end; ++i) {
+	for(size_t i = 0; i < codes.size(); ++i) {
+		bool const escaped = codes[i] == '$' and i + 1 < codes.size();
 		append_font_size(
-			ret,
-			boost::next(i) != end and *i == '$'
-			? ++i, (std::isalpha(*i)? Rect(0, 0, pixel_size(), pixel_size()):
-					*i == '$'? Rect(0, 0, pixel_size() / 2, pixel_size()):
-					(--i, GetSize(*i)))
-			: GetSize(*i));
+			ret.size,
+			escaped and is_exfont(codes[i + 1])? (++i, Rect(0, 0, pixel_size, pixel_size)):
+			escaped and codes[i + 1] == '$'? (++i, Rect(0, 0, pixel_size / 2, pixel_size)):
+			font.GetSize(codes[i]));
+	}
+
+	// drawing places "$$" as two glyphs
+	int x = 0;
+	for(size_t i = 0; i < codes.size(); ++i) {
+		if(codes[i] == '$' and i + 1 < codes.size() and is_exfont(codes[i + 1])) {
+			Font::Layout::Glyph const g = { codes[++i], true, x };
+			ret.glyphs.push_back(g);
+			x += 12;
+		} else {
+			Font::Layout::Glyph const g = { codes[i], false, x };
+			ret.glyphs.push_back(g);
+			x += font.GetSize(codes[i]).width;
+		}
 	}
 
 	return ret;
 }
 
+}
+
+Font::LayoutRef Font::GetLayout(std::string const& txt) const {
+	if(not layouts_) { layouts_.reset(new LayoutCache()); }
+	LayoutCache& c = *layouts_;
+
+	if(c.size != size) {
+		c.lru.clear();
+		c.index.clear();
+		c.size = size;
+	}
+
+	LayoutCache::index_type::iterator const i = c.index.find(txt);
+	if(i != c.index.end()) {
+		c.lru.splice(c.lru.begin(), c.lru, i->second);
+		return i->second->second;
+	}
+
+	if(c.lru.size() >= LAYOUT_CACHE_SIZE) {
+		c.index.erase(c.lru.back().first);
+		c.lru.pop_back();
+	}
+	c.lru.push_front(std::make_pair(txt, std::make_shared<Layout const>(create_layout(*this, txt))));
+	c.index[txt] = c.lru.begin();
+	return c.lru.front().second;
+}
+
+Rect Font::GetSize(std::string const& txt) const {
+	return GetLayout(txt)->size;
+}
+
 ShinonomeFont::ShinonomeFont(ShinonomeFont::function_type func)
 	: Font("Shinonome", POINT, false, false), func_(func) {}
 
@@ -166,9 +356,9 @@ Rect ShinonomeFont::GetSize(unsigned const g) const {
 	return Rect(0, 0, info->is_full? FULL_WIDTH : HALF_WIDTH, HEIGHT);
 }
 
-void ShinonomeFont::Render(Bitmap& bmp, int x, int y, Bitmap const& sys, int color, ShinonomeGlyph const& g) {
+void ShinonomeFont::Rasterize(Bitmap& bmp, int x, int y, Bitmap const& sys, int color, ShinonomeGlyph const& g) {
 	if(color != ColorShadow) {
-		Render(bmp, x + 1, y + 1, sys, ColorShadow, g);
+		Rasterize(bmp, x + 1, y + 1, sys, ColorShadow, g);
 	}
 
 	size_t const width = g.is_full? FULL_WIDTH : HALF_WIDTH;
@@ -186,26 +376,46 @@ void ShinonomeFont::Render(Bitmap& bmp, int x, int y, Bitmap const& sys, int col
 	}
 }
 
-void ShinonomeFont::Render(Bitmap& bmp, int const x, int const y, Bitmap const& sys, int color, unsigned code) {
-	ShinonomeGlyph const* const glyph = func_(code);
-	assert(glyph);
-	Render(bmp, x, y, sys, color, *glyph);
-}
-
-void ShinonomeFont::Render(Bitmap& bmp, int const x, int const y, unsigned code) {
-	ShinonomeGlyph const* const glyph = func_(code);
-	assert(glyph);
-	size_t const width = glyph->is_full? FULL_WIDTH : HALF_WIDTH;
+void ShinonomeFont::Rasterize(Bitmap& bmp, int const x, int const y, ShinonomeGlyph const& g) {
+	size_t const width = g.is_full? FULL_WIDTH : HALF_WIDTH;
 
 	for(size_t y_ = 0; y_ < HEIGHT; ++y_) {
 		for(size_t x_ = 0; x_ < width; ++x_) {
-			if(glyph->data[y_] & (0x1 << x_)) {
+			if(g.data[y_] & (0x1 << x_)) {
 				bmp.set_pixel(x + x_, y + y_, Font::default_color);
 			}
 		}
 	}
 }
 
+void ShinonomeFont::Render(Bitmap& bmp, int const x, int const y, Bitmap const& sys, int color, unsigned code) {
+	GlyphAtlas& atlas = atlases_[color];
+	atlas.Validate(sys.generation());
+
+	Rect r;
+	if(not atlas.Find(code, r)) {
+		ShinonomeGlyph const* const glyph = func_(code);
+		assert(glyph);
+		// one more pixel for the shadow
+		atlas.Add(code, (glyph->is_full? FULL_WIDTH : HALF_WIDTH) + 1, HEIGHT + 1, r);
+		Rasterize(atlas.page(), r.x, r.y, sys, color, *glyph);
+	}
+	bmp.blit(x, y, atlas.page(), r);
+}
+
+void ShinonomeFont::Render(Bitmap& bmp, int const x, int const y, unsigned code) {
+	GlyphAtlas& atlas = plain_atlases_.Get(Font::default_color);
+
+	Rect r;
+	if(not atlas.Find(code, r)) {
+		ShinonomeGlyph const* const glyph = func_(code);
+		assert(glyph);
+		atlas.Add(code, glyph->is_full? FULL_WIDTH : HALF_WIDTH, HEIGHT, r);
+		Rasterize(atlas.page(), r.x, r.y, *glyph);
+	}
+	bmp.blit(x, y, atlas.page(), r);
+}
+
 std::weak_ptr<boost::remove_pointer<FT_Library>::type> FTFont::library_checker_;
 
 FTFont::FTFont(const std::string& name, int size, bool bold, bool italic)
@@ -222,37 +432,61 @@ void FTFont::Render(Bitmap& bmp, int x, int y, Bitmap const& /* sys */, int /* c
 	Render(bmp, x, y, glyph);
 }
 
+bool FTFont::load_glyph(unsigned const glyph) {
+	if (FT_Load_Char(face_.get(), glyph, FT_LOAD_NO_BITMAP) != FT_Err_Ok) {
+		Output().Error(boost::format("Couldn't load FreeType character %d") % glyph);
+		return false;
+	}
+
+    if (FT_Render_Glyph(face_->glyph, FT_RENDER_MODE_MONO) != FT_Err_Ok) {
+		Output().Error(boost::format("Couldn't render FreeType character %d") % glyph);
+		return false;
+	}
+
+	assert(face_->glyph->bitmap.pixel_mode == FT_PIXEL_MODE_MONO);
+	return true;
+}
+
 void FTFont::Render(Bitmap& bmp, int const x, int const y, unsigned const glyph) {
 	if(!check_face()) {
 		Font::Shinonome()->Render(bmp, x, y, glyph);
 		return;
 	}
 
-	if (FT_Load_Char(face_.get(), glyph, FT_LOAD_NO_BITMAP) != FT_Err_Ok) {
-		Output().Error(boost::format("Couldn't load FreeType character %d") % glyph);
-		return;
-	}
+	GlyphAtlas& atlas = atlases_.Get(Font::default_color);
 
-    if (FT_Render_Glyph(face_->glyph, FT_RENDER_MODE_MONO) != FT_Err_Ok) {
-		Output().Error(boost::format("Couldn't render FreeType character %d") % glyph);
+	Rect r;
+	if(atlas.Find(glyph, r)) {
+		bmp.blit(x, y, atlas.page(), r);
 		return;
 	}
 
-	FT_Bitmap const& ft_bitmap = face_->glyph->bitmap;
-	assert(face_->glyph->bitmap.pixel_mode == FT_PIXEL_MODE_MONO);
+	if(not load_glyph(glyph)) { return; }
 
+	FT_Bitmap const& ft_bitmap = face_->glyph->bitmap;
 	size_t const pitch = std::abs(ft_bitmap.pitch);
 
+	// glyphs larger than a page are drawn directly
+	Bitmap* dst = &bmp;
+	int dst_x = x, dst_y = y;
+	if(atlas.Add(glyph, pitch * 8, ft_bitmap.rows, r)) {
+		dst = &atlas.page();
+		dst_x = r.x;
+		dst_y = r.y;
+	}
+
 	for(int row = 0; row < ft_bitmap.rows; ++row) {
 		for(size_t col = 0; col < pitch; ++col) {
 			unsigned c = ft_bitmap.buffer[pitch * row + col];
 			for(int bit = 7; bit >= 0; --bit) {
 				if(c & (0x01 << bit)) {
-					bmp.set_pixel(x + col * 8 + (7 - bit), y + row, Font::default_color);
+					dst->set_pixel(dst_x + col * 8 + (7 - bit), dst_y + row, Font::default_color);
 				}
 			}
 		}
 	}
+
+	if(dst != &bmp) { bmp.blit(x, y, *dst, r); }
 }
 
 FontRef Font::Shinonome(bool const m) {
@@ -280,6 +514,8 @@ Font::Font(const std::string& name, int size, bool bold, bool italic)
 {
 }
 
+Font::~Font() {}
+
 bool FTFont::check_face() {
 	if(!library_) {
 		if(library_checker_.expired()) {
@@ -319,6 +555,7 @@ bool FTFont::check_face() {
 			face_ = it->second.lock();
 		}
 		face_name_ = name;
+		atlases_.Clear();
 	}
 
 	face_->style_flags =
@@ -340,6 +577,7 @@ bool FTFont::check_face() {
 			return false;
 		}
 		current_size_ = size;
+		atlases_.Clear();
 	}
 
 	return true;
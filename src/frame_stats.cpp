@@ -0,0 +1,117 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+
+#include "frame_stats.h"
+
+size_t const FrameStats::HISTORY_SIZE;
+
+FrameStats::Scope::Scope(FrameStats& stats, Section section)
+		: stats(stats), section(section), start(clock::now()) {}
+
+FrameStats::Scope::~Scope() {
+	stats.Add(section, std::chrono::duration<double, std::milli>(clock::now() - start).count());
+}
+
+FrameStats::FrameStats()
+		: current(SECTION_END, 0.0)
+		, history(HISTORY_SIZE * SECTION_END, 0.0)
+		, history_pos(0)
+		, history_count(0) {}
+
+void FrameStats::Add(Section section, double msec) {
+	assert(section < SECTION_END);
+	current[section] += msec;
+}
+
+void FrameStats::Begin(Section section) {
+	assert(section < SECTION_END);
+	open.push_back(std::make_pair(section, clock::now()));
+}
+
+void FrameStats::End() {
+	assert(!open.empty());
+	if (open.empty()) return;
+
+	std::pair<Section, clock::time_point> const s = open.back();
+	open.pop_back();
+	Add(s.first, std::chrono::duration<double, std::milli>(clock::now() - s.second).count());
+}
+
+void FrameStats::EndFrame() {
+	std::copy(current.begin(), current.end(), history.begin() + history_pos * SECTION_END);
+	std::fill(current.begin(), current.end(), 0.0);
+
+	history_pos = (history_pos + 1) % HISTORY_SIZE;
+	history_count = std::min(history_count + 1, HISTORY_SIZE);
+}
+
+double FrameStats::GetPercentile(Section section, int percentile) const {
+	assert(section < SECTION_END);
+	if (history_count == 0) return 0.0;
+
+	std::vector<double> values(history_count);
+	for (size_t i = 0; i < history_count; ++i) {
+		values[i] = history[i * SECTION_END + section];
+	}
+
+	size_t const n = std::min(history_count - 1, history_count * std::max(0, std::min(percentile, 100)) / 100);
+	std::nth_element(values.begin(), values.begin() + n, values.end());
+	return values[n];
+}
+
+size_t FrameStats::GetFrameCount() const {
+	return history_count;
+}
+
+char const* FrameStats::GetName(Section section) {
+	static char const* const names[SECTION_END] = {
+		"player_update",
+		"scene_update",
+		"draw_frame",
+		"draw_window",
+		"draw_tilemap",
+		"draw_sprite",
+		"draw_plane",
+		"draw_background",
+		"draw_default",
+		"garbage_collect",
+		"update_display",
+		"audio_update",
+	};
+	assert(section < SECTION_END);
+	return names[section];
+}
+
+std::string FrameStats::ToString() const {
+	std::ostringstream ret;
+	ret << std::fixed << std::setprecision(2);
+	ret << "ms p50/p95/p99";
+	for (int i = 0; i < SECTION_END; ++i) {
+		Section const s = Section(i);
+		ret << "\n" << GetName(s) << " "
+			<< GetPercentile(s, 50) << "/"
+			<< GetPercentile(s, 95) << "/"
+			<< GetPercentile(s, 99);
+	}
+	return ret.str();
+}
@@ -30,12 +30,67 @@
 #include "cache.h"
 #include "baseui.h"
 #include "drawable.h"
+#include "font.h"
 #include "player.h"
 #include "zobj.h"
 
-#include <boost/bind.hpp>
+#include <pixman.h>
+
+#include <mruby/version.h>
+
 #include <boost/math/special_functions/round.hpp>
 
+namespace {
+
+/** Upper bound of pooled color masks (flash colors fade every frame). */
+size_t const COLOR_MASK_POOL_SIZE = 1024;
+
+/** Damage rects are merged into one bounding rect past this count. */
+size_t const DAMAGE_RECTS_MAX = 16;
+
+/** Full collection when the heap grew by this ratio since the last one. */
+double const FULL_GC_GROWTH_RATIO = 2.0;
+
+/** New incremental cycle when the heap grew by this ratio since the last one. */
+double const GC_CYCLE_GROWTH_RATIO = 1.2;
+
+/** Upper bound of incremental GC steps in a frame. */
+int const GC_STEPS_MAX = 64;
+
+size_t gc_live_objects(mrb_state* M) {
+#if MRUBY_RELEASE_MAJOR > 1 || (MRUBY_RELEASE_MAJOR == 1 && MRUBY_RELEASE_MINOR >= 2)
+	return M->gc.live;
+#else
+	return M->live;
+#endif
+}
+
+bool gc_cycle_running(mrb_state* M) {
+	// state 0 is GC_STATE_ROOT (GC_STATE_NONE in older releases)
+#if MRUBY_RELEASE_MAJOR > 1 || (MRUBY_RELEASE_MAJOR == 1 && MRUBY_RELEASE_MINOR >= 2)
+	return M->gc.state != 0;
+#else
+	return M->gc_state != 0;
+#endif
+}
+
+Rect union_rect(Rect const& a, Rect const& b) {
+	if (a.IsEmpty()) return b;
+	if (b.IsEmpty()) return a;
+
+	int const x0 = std::min(a.x, b.x), y0 = std::min(a.y, b.y);
+	int const x1 = std::max(a.x + a.width, b.x + b.width);
+	int const y1 = std::max(a.y + a.height, b.y + b.height);
+	return Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+pixman_image_ptr create_solid_fill(Color const& c) {
+	pixman_color_t const col = to_pixman(c);
+	return pixman_image_ptr(pixman_image_create_solid_fill(&col), &pixman_image_unref);
+}
+
+}
+
 
 unsigned Graphics_::SecondToFrame(float const second) {
 	return(second * framerate);
@@ -43,6 +98,7 @@ unsigned Graphics_::SecondToFrame(float const second) {
 
 Graphics_::Graphics_()
 		: fps_on_screen(false)
+		, stats_on_screen(false)
 		, drawable_id(0)
 		, overlay_visible(true)
 		, current_fps_(0)
@@ -65,7 +121,21 @@ Graphics_::Graphics_()
 										SCREEN_TARGET_HEIGHT,
 										Color(0, 0, 0, 255)))
 		, back_color(Color(0, 0, 0, 255))
-{}
+		, opacity_masks(256)
+		, mask_allocations_saved(0)
+		, last_mask_allocations_saved(0)
+		, damage_tracking(true)
+		, full_gc_requested(true)
+		, live_after_full_gc(0)
+		, live_after_gc_cycle(0)
+{
+	// full opacity needs no mask
+	for (int i = 0; i < 255; ++i) {
+		opacity_masks[i] = create_solid_fill(Color(0, 0, 0, i));
+	}
+
+	DamageAll();
+}
 
 BitmapRef const& Graphics_::ScreenBuffer() const {
 	return screen_buffer_;
@@ -75,6 +145,7 @@ Color const& Graphics_::GetBackcolor() const {
 	return back_color;
 }
 void Graphics_::SetBackcolor(const Color &color) {
+	if (back_color != color) DamageAll();
 	back_color = color;
 }
 
@@ -102,48 +173,170 @@ void Graphics_::UpdateTitle(double const fps) {
 }
 
 void Graphics_::DrawFrame() {
+	FrameStats::Scope const frame_scope(frame_stats, FrameStats::DrawFrame);
+
 	++fps_draw_counter;
 
+	last_mask_allocations_saved = mask_allocations_saved;
+	mask_allocations_saved = 0;
+
 	if (transition_duration > 0) {
 		UpdateTransition();
 		return;
 	}
 	if (screen_erased) return;
 
-	if (state->zlist_dirty) {
-		state->zlist.sort(SortZObj);
-		state->zlist_dirty = false;
+	if (damage_tracking) {
+		CollectDamage();
+		if (damage.empty()) {
+			FrameStats::Scope const display_scope(frame_stats, FrameStats::UpdateDisplay);
+			DisplayUi->UpdateDisplay(Rect());
+			return;
+		}
+		screen_buffer_->set_clip_rects(damage);
 	}
 
 	CleanScreen();
 
-	for (auto const& i : state->zlist) {
+	for (auto const& entry : state->zlist) {
+		ZObj* const i = entry.zobj;
 		Drawable* const d = i->GetId();
-		if(d->visible) { d->Draw(i->GetZ()); }
+		if (!d->visible) continue;
+
+		// skip drawables outside of the damaged area
+		Rect const& rect = i->GetScreenRect();
+		bool damaged = !damage_tracking || rect.IsEmpty();
+		for (size_t j = 0; !damaged && j < damage.size(); ++j) {
+			damaged = !rect.IsOutOfBounds(damage[j]);
+		}
+		if (damaged) { DrawZObj(*i); }
 	}
 
 	if (overlay_visible) {
 		DrawOverlay();
 	}
+	overlay_rect = GetOverlayRect();
 
-	DisplayUi->UpdateDisplay();
+	FrameStats::Scope const display_scope(frame_stats, FrameStats::UpdateDisplay);
+	if (damage_tracking) {
+		Rect bounds;
+		for (auto const& i : damage) {
+			bounds = union_rect(bounds, i);
+		}
+		screen_buffer_->set_clip_rects(std::vector<Rect>());
+		damage.clear();
+
+		DisplayUi->UpdateDisplay(bounds);
+	} else {
+		DisplayUi->UpdateDisplay();
+	}
+}
+
+void Graphics_::DrawZObj(ZObj const& zobj) {
+	Drawable* const d = zobj.GetId();
+	FrameStats::Scope const scope(
+		frame_stats, FrameStats::Section(FrameStats::DrawWindow + d->type));
+	d->Draw(zobj.GetZ());
+}
+
+void Graphics_::CollectDamage() {
+	for (auto const& entry : state->zlist) {
+		ZObj* const i = entry.zobj;
+		Drawable* const d = i->GetId();
+
+		DrawState draw_state;
+		if (d->visible) { d->GetDrawState(i->GetZ(), draw_state); }
+
+		// damage both last frame's area and the new one
+		if (draw_state.signature != i->GetSignature() || draw_state.rect != i->GetScreenRect()) {
+			AddDamage(i->GetScreenRect());
+			AddDamage(draw_state.rect);
+			i->SetScreenRect(draw_state.rect);
+			i->SetSignature(draw_state.signature);
+		}
+	}
+
+	// the overlay is drawn over the composited frame
+	AddDamage(overlay_rect);
+	AddDamage(GetOverlayRect());
+}
+
+bool Graphics_::GetDamageTracking() const {
+	return damage_tracking;
+}
+void Graphics_::SetDamageTracking(bool v) {
+	if (v && !damage_tracking) DamageAll();
+	damage_tracking = v;
+}
+
+void Graphics_::AddDamage(Rect const& rect) {
+	Rect r = rect;
+	r.Adjust(screen_buffer_->rect());
+	if (r.IsEmpty()) return;
+
+	for (auto& i : damage) {
+		if (!r.IsOutOfBounds(i)) {
+			i = union_rect(i, r);
+			return;
+		}
+	}
+
+	damage.push_back(r);
+	if (damage.size() > DAMAGE_RECTS_MAX) {
+		Rect bounds;
+		for (auto const& i : damage) {
+			bounds = union_rect(bounds, i);
+		}
+		damage.assign(1, bounds);
+	}
+}
+
+void Graphics_::DamageAll() {
+	damage.assign(1, screen_buffer_->rect());
 }
 
 void Graphics_::DrawOverlay() {
-	if (Graphics().fps_on_screen) {
-		std::ostringstream text;
-		text << "FPS: " << std::setprecision(4) << current_fps_;
-		DisplayUi->DrawScreenText(text.str());
+	std::ostringstream text;
+	if (fps_on_screen) {
+		text << "FPS: " << std::setprecision(4) << current_fps_ << "\n";
+	}
+	if (stats_on_screen) {
+		text << frame_stats.ToString() << "\n";
+	}
+
+	std::string const str = text.str();
+	if (!str.empty()) {
+		DisplayUi->DrawScreenText(str.substr(0, str.size() - 1));
 	}
 }
 
+Rect Graphics_::GetOverlayRect() const {
+	int lines = 0;
+	if (fps_on_screen) lines += 1;
+	if (stats_on_screen) lines += FrameStats::SECTION_END + 1;
+	if (!overlay_visible || lines == 0) return Rect();
+
+	// DrawScreenText starts at (12, 12)
+	return Rect(0, 0, screen_buffer_->width(), 12 + lines * Font::Shinonome()->pixel_size() + 4);
+}
+
+FrameStats const& Graphics_::GetFrameStats() const {
+	return frame_stats;
+}
+
+FrameStats& Graphics_::GetFrameStats() {
+	return frame_stats;
+}
+
 BitmapRef Graphics_::SnapToBitmap() {
 	CleanScreen();
 
-	for (auto const& i : state->zlist) {
+	for (auto const& entry : state->zlist) {
+		ZObj* const i = entry.zobj;
 		Drawable* const d = i->GetId();
 		if(d->visible) { d->Draw(i->GetZ()); }
 	}
+	DamageAll();
 
 	return Bitmap::Create(screen_buffer_);
 }
@@ -161,11 +354,6 @@ void Graphics_::Transition(TransitionType type, int duration, bool erase) {
 		transition_frame = 0;
 		transition_duration = type == TransitionErase ? 1 : duration;
 
-		if (state->zlist_dirty) {
-			state->zlist.sort(SortZObj);
-			state->zlist_dirty = false;
-		}
-
 		if (!frozen) Freeze();
 
 		if (erase) {
@@ -193,6 +381,8 @@ void Graphics_::Transition(TransitionType type, int duration, bool erase) {
 	screen_erased = erase;
 
 	transition_duration = 0;
+	DamageAll();
+	RequestFullGC();
 
 	FrameReset();
 }
@@ -344,6 +534,7 @@ void Graphics_::UpdateTransition() {
 		break;
 	}
 
+	FrameStats::Scope const display_scope(frame_stats, FrameStats::UpdateDisplay);
 	DisplayUi->UpdateDisplay();
 }
 
@@ -367,8 +558,8 @@ void Graphics_::InternUpdate() {
 	unsigned const frame_start_time = DisplayUi->GetTicks();
 	if(frame_start_time < expected_next_frame_end_time) {
 		DrawFrame();
-		mrb_garbage_collect(Player::current_vm());
 	}
+	UpdateGarbageCollection();
 	unsigned const frame_end_time = DisplayUi->GetTicks();
 
 	// calculate FPS if passed FPS calculation time
@@ -392,6 +583,36 @@ void Graphics_::InternUpdate() {
 
 	// update next frame end time
 	expected_next_frame_end_time += frame_interval;
+
+	frame_stats.EndFrame();
+}
+
+void Graphics_::UpdateGarbageCollection() {
+	mrb_state* const M = Player::current_vm();
+	FrameStats::Scope const gc_scope(frame_stats, FrameStats::GarbageCollect);
+
+	size_t const live = gc_live_objects(M);
+	if (full_gc_requested || live > live_after_full_gc * FULL_GC_GROWTH_RATIO) {
+		mrb_full_gc(M);
+		full_gc_requested = false;
+		live_after_full_gc = live_after_gc_cycle = gc_live_objects(M);
+		return;
+	}
+
+	if (!gc_cycle_running(M) && live <= live_after_gc_cycle * GC_CYCLE_GROWTH_RATIO) return;
+
+	// incremental steps in the time left for this frame
+	for (int i = 0; i < GC_STEPS_MAX && DisplayUi->GetTicks() + 1 < expected_next_frame_end_time; ++i) {
+		mrb_incremental_gc(M);
+		if (!gc_cycle_running(M)) {
+			live_after_gc_cycle = gc_live_objects(M);
+			break;
+		}
+	}
+}
+
+void Graphics_::RequestFullGC() {
+	full_gc_requested = true;
 }
 
 void Graphics_::Wait(int duration) {
@@ -415,43 +636,78 @@ void Graphics_::SetFrameRate(int v) {
 }
 
 ZObj* Graphics_::RegisterZObj(int z, Drawable* ID) {
-	state->zlist.push_back(std::unique_ptr<ZObj>(new ZObj(z, drawable_creation++, ID)));
-	state->zlist_dirty = true;
-	return state->zlist.back().get();
+	return state->zlist.Insert(z, drawable_creation++, ID);
 }
 
 void Graphics_::RegisterZObj(int z, Drawable* ID, bool /* multiz */) {
-	state->zlist.push_back(std::unique_ptr<ZObj>(new ZObj(z, 999999, ID)));
-	state->zlist_dirty = true;
-}
-
-static bool check_id(std::unique_ptr<ZObj> const& z, Drawable* const ID) {
-	return z->GetId() == ID;
+	state->zlist.Insert(z, 999999, ID);
 }
 
 void Graphics_::RemoveZObj(Drawable* ID, bool) {
-	state->zlist.remove_if(boost::bind(&check_id, _1, ID));
+	for (auto const& entry : state->zlist) {
+		ZObj* const i = entry.zobj;
+		if (i->GetId() == ID) AddDamage(i->GetScreenRect());
+	}
+	state->zlist.Remove(ID);
 }
 
-void Graphics_::UpdateZObj(ZObj* zobj, int z) {
-	zobj->SetZ(z);
-	state->zlist_dirty = true;
+void Graphics_::RemoveZObj(int z, Drawable* ID) {
+	std::unique_ptr<ZObj> const removed = state->zlist.Remove(z, ID);
+	if (removed) AddDamage(removed->GetScreenRect());
 }
 
-inline bool Graphics_::SortZObj(std::unique_ptr<ZObj> const& first, std::unique_ptr<ZObj> const& second) {
-	if (first->GetZ() < second->GetZ()) return true;
-	else if (first->GetZ() > second->GetZ()) return false;
-	else return first->GetCreation() < second->GetCreation();
+void Graphics_::UpdateZObj(ZObj* zobj, int z) {
+	// the ZObj may belong to a pushed state
+	if (!state->zlist.Update(zobj, z)) {
+		for (auto const& i : stack) {
+			if (i->zlist.Update(zobj, z)) break;
+		}
+	}
+	zobj->SetSignature(0);
 }
 
 void Graphics_::Push() {
 	stack.push_back(std::move(state));
 	state = std::unique_ptr<State>(new State());
+	DamageAll();
+	RequestFullGC();
 }
 
 void Graphics_::Pop() {
 	if (stack.size() > 0) {
 		state = std::move(stack.back());
 		stack.pop_back();
+		DamageAll();
+		RequestFullGC();
+	}
+}
+
+pixman_image_ptr const& Graphics_::GetOpacityMask(int opacity) {
+	pixman_image_ptr const& ret = opacity_masks[std::max(0, std::min(opacity, 255))];
+	if (ret) { ++mask_allocations_saved; }
+	return ret;
+}
+
+pixman_image_ptr const& Graphics_::GetColorMask(Color const& color) {
+	if (color.red == 0 && color.green == 0 && color.blue == 0) {
+		return GetOpacityMask(color.alpha);
+	}
+
+	uint32_t const key =
+		(color.red << 24) | (color.green << 16) | (color.blue << 8) | color.alpha;
+	pixman_image_ptr& ret = color_masks[key];
+	if (ret) {
+		++mask_allocations_saved;
+	} else {
+		if (color_masks.size() > COLOR_MASK_POOL_SIZE) {
+			color_masks.clear();
+			return color_masks[key] = create_solid_fill(color);
+		}
+		ret = create_solid_fill(color);
 	}
+	return ret;
+}
+
+unsigned Graphics_::GetMaskAllocationsSaved() const {
+	return last_mask_allocations_saved;
 }
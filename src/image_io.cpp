@@ -8,6 +8,7 @@
 #include <zlib.h>
 
 #include <array>
+#include <cassert>
 #include <fstream>
 
 #include <boost/scope_exit.hpp>
@@ -20,15 +21,24 @@
 
 namespace {
 
-typedef boost::function<BitmapRef(std::istream&, bool)> image_reader;
-typedef boost::container::flat_map<std::string, image_reader> ext_map_type;
+typedef boost::function<bool(std::istream&, bool, ImageIO::Image&)> image_decoder;
+typedef boost::container::flat_map<std::string, image_decoder> ext_map_type;
 static ext_map_type const ext_map =
 		boost::assign::map_list_of
-		("bmp", image_reader(&ImageIO::ReadBMP))
-		("png", &ImageIO::ReadPNG)
-		("xyz", &ImageIO::ReadXYZ)
+		("bmp", image_decoder(&ImageIO::DecodeBMP))
+		("png", &ImageIO::DecodePNG)
+		("xyz", &ImageIO::DecodeXYZ)
 		;
 
+bool fail(ImageIO::Image& img, std::string const& error) {
+	img.error = error;
+	return false;
+}
+
+BitmapRef to_bitmap(ImageIO::Image& img, bool const decoded) {
+	return decoded? Bitmap::Create(img) : (Output().Debug(img.error), BitmapRef());
+}
+
 void write_data(png_structp out_ptr, png_bytep data, png_size_t len) {
 	reinterpret_cast<std::ostream*>(png_get_io_ptr(out_ptr))
 			->write(reinterpret_cast<char const*>(data), len);
@@ -50,14 +60,23 @@ uint32_t get_4(std::istream& is) {
 			(unsigned(is.get()) << 16) | (unsigned(is.get()) << 24) ;
 }
 
-typedef std::array<uint8_t, 4> RawPngColor;
-Color to_color(RawPngColor const& c) {
-	return Color(c[0], c[1], c[2], c[3]);
+typedef std::array<Color, 0x100> Palette;
+
+// index 0 is the color key of transparent images
+void set_color_key(Palette& pal, bool const transparent) {
+	if (transparent) { pal[0].alpha = 0x00; }
 }
 
+// one table lookup per pixel instead of building each Color
+void expand_row(Color* dst, uint8_t const* src, size_t const width, Palette const& pal) {
+	for (size_t x = 0; x < width; ++x) {
+		dst[x] = pal[src[x]];
+	}
 }
 
-BitmapRef ImageIO::ReadBMP(std::istream& is, bool const transparent) {
+}
+
+bool ImageIO::DecodeBMP(std::istream& is, bool const transparent, Image& ret) {
 	size_t const start_pos = is.tellg();
 
 	// BITMAPFILEHEADER structure
@@ -72,12 +91,13 @@ BitmapRef ImageIO::ReadBMP(std::istream& is, bool const transparent) {
 	enum { SIGNATURE_SIZE = sizeof(SIGNATURE) - 1 };
 	std::array<char, SIGNATURE_SIZE> signature_buf;
 	is.read(signature_buf.data(), SIGNATURE_SIZE);
-	if (std::string(signature_buf.begin(), signature_buf.end()) == SIGNATURE) {
-		return Output().Debug("Not a valid BMP file."), BitmapRef();
+	if (std::string(signature_buf.begin(), signature_buf.end()) != SIGNATURE) {
+		return fail(ret, "Not a valid BMP file.");
 	}
 
 	// file size is skipped because every program writes other data into
 	// this field and not needed for correct decoding.
+	is.seekg(start_pos + 10);
 
 	const unsigned bits_offset = get_4(is);
 
@@ -96,9 +116,10 @@ BitmapRef ImageIO::ReadBMP(std::istream& is, bool const transparent) {
 	// 36	4	number of important palette colors
 	// 40 ... palette
 
+	enum { BITMAPFILEHEADER_SIZE = 14 };
 	static const unsigned BITMAPINFOHEADER_SIZE = 40;
 	if (get_4(is) != BITMAPINFOHEADER_SIZE) {
-		return Output().Debug("Incorrect BMP header size."), BitmapRef();
+		return fail(ret, "Incorrect BMP header size.");
 	}
 
 	int32_t width = get_4(is), raw_height = get_4(is);
@@ -108,68 +129,90 @@ BitmapRef ImageIO::ReadBMP(std::istream& is, bool const transparent) {
 
 	const int planes = get_2(is);
 	if (planes != 1) {
-		return Output().Debug("BMP planes is not 1."), BitmapRef();
+		return fail(ret, "BMP planes is not 1.");
 	}
 
 	const int depth = get_2(is);
 	if (depth != 8) {
-		return Output().Debug("BMP image is not 8-bit."), BitmapRef();
+		return fail(ret, "BMP image is not 8-bit.");
 	}
 
 	const int compression = get_4(is);
 	static const int BI_RGB = 0;
 	if (compression != BI_RGB) {
-		return Output().Debug("compressed BMP not supported."), BitmapRef();
+		return fail(ret, "compressed BMP not supported.");
 	}
 
 	int const image_size = get_4(is);
-	if (image_size != 0 && image_size != width * height) {
-		return Output().Debug("Invalid BMP image size."), BitmapRef();
+	// may include the line padding
+	if (image_size != 0 && image_size < width * height) {
+		return fail(ret, "Invalid BMP image size.");
 	}
 
-	int const num_colors = std::min(256U, get_4(is));
-	boost::container::vector<std::array<uint8_t, 4> > palette(num_colors);
-	is.read(reinterpret_cast<char*>(palette.data()), num_colors * 4);
+	// pixels per meter aren't needed
+	is.seekg(8, std::ios::cur);
+
+	// 0 colors means a full palette
+	unsigned const colors_used = get_4(is);
+	int const num_colors = colors_used == 0? 256 : std::min(256U, colors_used);
+	is.seekg(start_pos + BITMAPFILEHEADER_SIZE + BITMAPINFOHEADER_SIZE);
+	boost::container::vector<std::array<uint8_t, 4> > raw_palette(num_colors);
+	is.read(reinterpret_cast<char*>(raw_palette.data()), num_colors * 4);
 
 	// Ensure no palette entry is an exact duplicate of #0
 	for (int i = 1; i < num_colors; i++) {
-		if (palette[i][0] == palette[0][0] &&
-			palette[i][1] == palette[0][1] &&
-			palette[i][2] == palette[0][2]) {
-			palette[i][0] ^= 1;
+		if (raw_palette[i][0] == raw_palette[0][0] &&
+			raw_palette[i][1] == raw_palette[0][1] &&
+			raw_palette[i][2] == raw_palette[0][2]) {
+			raw_palette[i][0] ^= 1;
 		}
 	}
 
-	BitmapRef const ret = Bitmap::Create(width, height);
+	Palette palette;
+	palette.fill(Color(0, 0, 0, 0xff));
+	for (int i = 0; i < num_colors; i++) {
+		palette[i] = Color(raw_palette[i][2], raw_palette[i][1], raw_palette[i][0], 0xff);
+	}
+	set_color_key(palette, transparent);
 
 	// align each line with 4 bytes
 	size_t const line_size = (width * depth) >> 3;
 	size_t const aligned_width =
 			(line_size & 0x03u)? (((line_size >> 2) + 1) << 2) : line_size;
 
+	// whole pixel data at once instead of a seek per line
+	boost::container::vector<uint8_t> bits(aligned_width * height);
+	is.seekg(start_pos + bits_offset);
+	is.read(reinterpret_cast<char*>(bits.data()), bits.size());
+	if (size_t(is.gcount()) != bits.size()) {
+		return fail(ret, "BMP pixel data is truncated.");
+	}
+
+	ret.width = width;
+	ret.height = height;
+	ret.pixels.resize(width * height);
+
 	for (int y = 0; y < height; y++) {
-		is.seekg(start_pos + bits_offset + (vflip ? height - 1 - y : y) * aligned_width);
-		for (int x = 0; x < width; x++) {
-			uint8_t const idx = is.get();
-			std::array<uint8_t, 4> const& pal = palette[idx];
-			ret->set_pixel(x, y, Color(
-				pal[2], pal[1], pal[0], (transparent && idx == 0)? 0x00 : 0xff));
-		}
+		expand_row(ret.row(y), &bits[(vflip ? height - 1 - y : y) * aligned_width],
+				   width, palette);
 	}
 
-	return ret;
+	return true;
 }
 
-BitmapRef ImageIO::ReadPNG(std::istream& is, bool const transparent) {
+bool ImageIO::DecodePNG(std::istream& is, bool const transparent, Image& ret) {
 	png_struct* png_ptr = png_create_read_struct(
 		PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 	if (not png_ptr) {
-		return Output().Debug("Couldn't allocate PNG structure"), BitmapRef();
+		return fail(ret, "Couldn't allocate PNG structure");
 	}
 
-	png_info* info_ptr = png_create_info_struct(png_ptr);
-	if (not info_ptr) {
-		return Output().Debug("Couldn't allocate PNG info structure"), BitmapRef();
+	png_info* info_ptr = NULL;
+	BOOST_SCOPE_EXIT((&png_ptr)(&info_ptr)) {
+		png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+	} BOOST_SCOPE_EXIT_END do {} while(0);
+	if (not (info_ptr = png_create_info_struct(png_ptr))) {
+		return fail(ret, "Couldn't allocate PNG info structure");
 	}
 
 	png_set_read_fn(png_ptr, (png_voidp) &is, read_data);
@@ -187,7 +230,7 @@ BitmapRef ImageIO::ReadPNG(std::istream& is, bool const transparent) {
 	switch (color_type) {
 		case PNG_COLOR_TYPE_PALETTE:
 			if (!png_get_valid(png_ptr, info_ptr, PNG_INFO_PLTE)) {
-				return Output().Debug("Palette PNG without PLTE block"), BitmapRef();
+				return fail(ret, "Palette PNG without PLTE block");
 			}
 			if (transparent) {
 				png_get_PLTE(png_ptr, info_ptr, &palette, &num_palette);
@@ -217,50 +260,51 @@ BitmapRef ImageIO::ReadPNG(std::istream& is, bool const transparent) {
 		case PNG_COLOR_TYPE_RGB_ALPHA:
 			break;
 		default:
-			return Output().Debug(boost::format("unsupported color type: %d") % color_type), BitmapRef();
+			return fail(ret, (boost::format("unsupported color type: %d") % color_type).str());
 	}
 
 	if (bit_depth < 8) { png_set_packing(png_ptr); }
 	if (bit_depth == 16) { png_set_strip_16(png_ptr); }
+	// all passes of interlaced images, must be set before the update
+	png_set_interlace_handling(png_ptr);
 
 	png_read_update_info(png_ptr, info_ptr);
 
-	BitmapRef const ret = Bitmap::Create(width, height);
-	boost::container::vector<RawPngColor> buf(width);
+	// every format is expanded to 8-bit RGBA, the layout of Color
+	assert(png_get_rowbytes(png_ptr, info_ptr) == width * sizeof(Color));
+
+	ret.width = width;
+	ret.height = height;
+	ret.pixels.resize(width * height);
+
+	// libpng writes the rows in place
+	boost::container::vector<png_bytep> rows(height);
+	for (size_t y = 0; y < height; y++) {
+		rows[y] = reinterpret_cast<png_bytep>(ret.row(y));
+	}
+	png_read_image(png_ptr, rows.data());
+	png_read_end(png_ptr, NULL);
 
 	if (transparent and palette) {
 		Color const src_color(palette->red, palette->green, palette->blue, 0xff);
 		Color const dst_color(0, 0, 0, 0);
 
-		for (size_t y = 0; y < height; y++) {
-			png_read_row(png_ptr, reinterpret_cast<png_bytep>(buf.data()), NULL);
-			for(size_t x = 0; x < width; ++x) {
-				Color const c = to_color(buf[x]);
-				ret->set_pixel(x, y, (c == src_color)? dst_color : c);
-			}
-		}
-	} else {
-		for (size_t y = 0; y < height; y++) {
-			png_read_row(png_ptr, reinterpret_cast<png_bytep>(buf.data()), NULL);
-			for(size_t x = 0; x < width; ++x) {
-				ret->set_pixel(x, y, to_color(buf[x]));
-			}
+		Color* const end = ret.pixels.data() + ret.pixels.size();
+		for (Color* c = ret.pixels.data(); c < end; ++c) {
+			if (*c == src_color) { *c = dst_color; }
 		}
 	}
 
-	png_read_end(png_ptr, NULL);
-	png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
-
-	return ret;
+	return true;
 }
 
-BitmapRef ImageIO::ReadXYZ(std::istream& is, bool const transparent) {
+bool ImageIO::DecodeXYZ(std::istream& is, bool const transparent, Image& ret) {
 	static char const SIGNATURE[] = "XYZ1";
 	enum { SIGNATURE_SIZE = sizeof(SIGNATURE) - 1 };
 	std::array<char, SIGNATURE_SIZE> signature_buf;
 	is.read(signature_buf.data(), SIGNATURE_SIZE);
-	if (std::string(signature_buf.begin(), signature_buf.end()) == SIGNATURE) {
-		return Output().Debug("Not a valid XYZ file."), BitmapRef();
+	if (std::string(signature_buf.begin(), signature_buf.end()) != SIGNATURE) {
+		return fail(ret, "Not a valid XYZ file.");
 	}
 
 	uint16_t const width = get_2(is), height = get_2(is);
@@ -281,40 +325,50 @@ BitmapRef ImageIO::ReadXYZ(std::istream& is, bool const transparent) {
 
 	if (uncompress(dst_buf.data(), &dst_size,
 				   reinterpret_cast<Bytef const*>(src_buf.data()), src_size) != Z_OK) {
-		return Output().Debug("Error decompressing XYZ file."), BitmapRef();
+		return fail(ret, "Error decompressing XYZ file.");
 	}
-	assert(dst_size == 0);
-
-	BitmapRef const ret = Bitmap::Create(width, height);
-
-    for (int y = 0; y < height; y++) {
-		for (int x = 0; x < width; x++) {
-			uint8_t const idx = dst_buf[PALETTE_SIZE + width * y + x];
-			size_t const pal_off = 0 + 3 * idx;
-			ret->set_pixel(x, y, Color(
-				dst_buf[pal_off + 0],
-				dst_buf[pal_off + 1],
-				dst_buf[pal_off + 2],
-				(transparent && idx == 0) ? 0x00 : 0xff));
-		}
-    }
+	if (dst_size != dst_buf.size()) {
+		return fail(ret, "XYZ image data is truncated.");
+	}
+
+	Palette palette;
+	for (size_t i = 0; i < palette.size(); i++) {
+		palette[i] = Color(dst_buf[3 * i + 0], dst_buf[3 * i + 1], dst_buf[3 * i + 2], 0xff);
+	}
+	set_color_key(palette, transparent);
+
+	ret.width = width;
+	ret.height = height;
+	ret.pixels.resize(width * height);
+
+	// rows are stored without padding
+	expand_row(ret.pixels.data(), dst_buf.data() + PALETTE_SIZE, ret.pixels.size(), palette);
+
+	return true;
+}
+
+BitmapRef ImageIO::ReadBMP(std::istream& is, bool const transparent) {
+	Image img;
+	return to_bitmap(img, DecodeBMP(is, transparent, img));
+}
+
+BitmapRef ImageIO::ReadPNG(std::istream& is, bool const transparent) {
+	Image img;
+	return to_bitmap(img, DecodePNG(is, transparent, img));
+}
 
-	return ret;
+BitmapRef ImageIO::ReadXYZ(std::istream& is, bool const transparent) {
+	Image img;
+	return to_bitmap(img, DecodeXYZ(is, transparent, img));
 }
 
 bool ImageIO::WritePNG(BitmapRef const& bmp, std::ostream& os) {
 	size_t const width = bmp->width(), height = bmp->height();
 
-	boost::container::vector<uint32_t> data(width * height);
-	for(size_t y = 0; y < height; ++y) {
-		for(size_t x = 0; x < width; ++x) {
-			reinterpret_cast<Color&>(data[width * y + x]) = bmp->get_pixel(x, y);
-		}
-	}
-
+	// Color is 8-bit RGBA, rows are written straight from the bitmap
 	boost::container::vector<png_bytep> ptrs(height);
 	for(size_t i = 0; i < ptrs.size(); ++i) {
-		ptrs[i] = reinterpret_cast<png_bytep>(&data[width*i]);
+		ptrs[i] = reinterpret_cast<png_bytep>(const_cast<Color*>(bmp->row(i)));
 	}
 
 	png_structp write = NULL;
@@ -342,15 +396,22 @@ bool ImageIO::WritePNG(BitmapRef const& bmp, std::ostream& os) {
 	return true;
 }
 
-BitmapRef ImageIO::ReadImage(std::string const& file, bool const transparent) {
-	if(not FileFinder().Exists(file)) {
-		return Output().Debug(boost::format("image file not found: %s") % file), BitmapRef();
-	}
-
+bool ImageIO::DecodeImage(std::string const& file, bool const transparent, Image& ret) {
 	std::string const ext = Utils::GetExt(file);
 	ext_map_type::const_iterator const it = ext_map.find(ext);
-	return (it == ext_map.end())
-			? Output().Debug(boost::format("Unsupported extension: %s") % ext), BitmapRef()
-			: it->second(*FileFinder().openUTF8(
-				file, std::ios::binary | std::ios::in), transparent);
+	if(it == ext_map.end()) {
+		return fail(ret, (boost::format("Unsupported extension: %s") % ext).str());
+	}
+
+	std::unique_ptr<std::fstream> const is =
+			FileFinder_::openUTF8(file, std::ios::binary | std::ios::in);
+	if(not is) {
+		return fail(ret, (boost::format("image file not found: %s") % file).str());
+	}
+	return it->second(*is, transparent, ret);
+}
+
+BitmapRef ImageIO::ReadImage(std::string const& file, bool const transparent) {
+	Image img;
+	return to_bitmap(img, DecodeImage(file, transparent, img));
 }
@@ -20,10 +20,16 @@
 #include <cstdarg>
 #include <ctime>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <exception>
+#include <thread>
 
 #include "audio.h"
 #include "filefinder.h"
@@ -64,15 +70,120 @@ Color const& Output_::TypeColor(Type t) const {
 	return type_color[t];
 }
 
+struct Output_::LogWriter : boost::noncopyable {
+	/** Power of two, messages are dropped while it is full. */
+	enum { CAPACITY = 256 };
+
+	struct Entry {
+		std::string log, console;
+	};
+
+	LogWriter()
+			: file(OUTPUT_FILENAME, std::ios_base::out | std::ios_base::app)
+			, head(0), tail(0), dropped(0), quit(false)
+			, thread(&LogWriter::Work, this) {}
+
+	~LogWriter() {
+		quit = true;
+		written.notify_one();
+		thread.join();
+	}
+
+	/**
+	 * Queues a message, only called from the thread owning Output_.
+	 *
+	 * @param log text appended to the log file.
+	 * @param console text printed to stdout, empty to skip.
+	 */
+	void Push(std::string const& log, std::string const& console) {
+		if (dropped > 0 and Free() > 1) {
+			std::ostringstream ss;
+			ss << "(" << dropped << " messages dropped, log buffer was full)" << std::endl;
+			dropped = 0;
+			Store(ss.str(), std::string());
+		}
+		if (Free() == 0) {
+			++dropped;
+			return;
+		}
+		Store(log, console);
+		written.notify_one();
+	}
+
+	void Flush() {
+		written.notify_one();
+		while (tail.load(std::memory_order_acquire) != head.load(std::memory_order_relaxed)) {
+			std::this_thread::yield();
+		}
+	}
+
+  private:
+	size_t Free() const {
+		return CAPACITY - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire));
+	}
+
+	void Store(std::string const& log, std::string const& console) {
+		size_t const h = head.load(std::memory_order_relaxed);
+		Entry& e = entries[h & (CAPACITY - 1)];
+		e.log = log;
+		e.console = console;
+		head.store(h + 1, std::memory_order_release);
+	}
+
+	void Work() {
+		for (;;) {
+			size_t t = tail.load(std::memory_order_relaxed);
+			size_t const h = head.load(std::memory_order_acquire);
+			if (t == h) {
+				if (quit) { return; }
+				// a missed notification only delays the write
+				std::unique_lock<std::mutex> lock(mutex);
+				written.wait_for(lock, std::chrono::milliseconds(100));
+				continue;
+			}
+
+			for (; t != h; ++t) {
+				Entry& e = entries[t & (CAPACITY - 1)];
+				file << e.log;
+				if (not e.console.empty()) { std::cout << e.console; }
+				e.log.clear();
+				e.console.clear();
+			}
+			file.flush();
+			std::cout.flush();
+			tail.store(t, std::memory_order_release);
+		}
+	}
+
+	std::ofstream file;
+	std::array<Entry, CAPACITY> entries;
+	// head is written by the producer, tail by the log thread
+	std::atomic<size_t> head, tail;
+	size_t dropped;
+
+	std::atomic<bool> quit;
+	std::mutex mutex;
+	std::condition_variable written;
+	std::thread thread;
+};
+
 Output_::buffer_type const& Output_::buffer() const {
 	return buffer_;
 }
 
 Output_::Output_()
 		: ignore_pause_(false), enable_stdout_(true)
-		, log_file_(OUTPUT_FILENAME, std::ios_base::out | std::ios_base::app)
+		, writer_(new LogWriter())
 		, buffer_(BUFFER_SIZE)
-{}
+		, screenshot_index_(0)
+{
+	for (size_t i = 0; i < TYPE_END; ++i) {
+		RateLimit const l = { 0, 0, 0 };
+		rate_limits_[i] = l;
+	}
+}
+
+Output_::~Output_() {}
 
 Output_::Message::Message() {}
 Output_::Message::Message(Type t, std::string const& m, boost::optional<std::string> const& ss)
@@ -95,10 +206,30 @@ std::string Output_::utc_time(std::time_t const t, bool time_only) const {
 	return buf;
 }
 
-std::ostream& Output_::output_time(std::time_t const t) {
-	return log_file_
-			<< "Local: " << local_time(t) << ", "
-			<< "UTC: " << utc_time(t) << std::endl;
+void Output_::Flush() {
+	writer_->Flush();
+}
+
+bool Output_::CheckRateLimit(Type const t, std::time_t const now) {
+	static unsigned const limits[TYPE_END] = { DEBUG_LIMIT, WARNING_LIMIT, 0 };
+	if (limits[t] == 0) { return true; }
+
+	RateLimit& l = rate_limits_[t];
+	if (l.second != now) {
+		if (l.suppressed > 0) {
+			std::ostringstream ss;
+			ss << "(" << l.suppressed << " " << Type2String(t) << " messages suppressed)" << std::endl;
+			writer_->Push(ss.str(), std::string());
+		}
+		l.second = now;
+		l.count = l.suppressed = 0;
+	}
+	if (l.count >= limits[t]) {
+		++l.suppressed;
+		return false;
+	}
+	++l.count;
+	return true;
 }
 
 void Output_::EnableStdout(bool v) {
@@ -113,13 +244,22 @@ template<Output_::Type T>
 void Output_::HandleScreenOutput(std::string const& msg, bool exit) {
 	using std::endl;
 
-	buffer_.push_back(Message(T, msg, TakeScreenshot()));
+	std::time_t const now = std::time(NULL);
+	if (not CheckRateLimit(T, now)) { return; }
+
+	// encoding the screen costs frames, so only errors keep one
+	buffer_.push_back(Message(T, msg, T == TypeError? TakeScreenshot() : boost::none));
 	Message const& m = buffer_.back();
 
-	output_time(m.time) << Type2String(m.type) << ":" << endl << "  " << msg << endl;
-	if(enable_stdout_) {
-		std::cout << Type2String(m.type) << " : " << msg << endl;
-	}
+	std::ostringstream log;
+	log << "Local: " << local_time(m.time) << ", "
+		<< "UTC: " << utc_time(m.time) << endl
+		<< Type2String(m.type) << ":" << endl << "  " << msg << endl;
+	writer_->Push(log.str(), enable_stdout_
+				  ? std::string(Type2String(m.type)) + " : " + msg + "\n"
+				  : std::string());
+	// the player may pause, exit or raise below
+	if (T == TypeError or not ignore_pause_) { writer_->Flush(); }
 
 	if(ignore_pause_) { return; }
 
@@ -176,10 +316,9 @@ boost::optional<std::string> Output_::TakeScreenshot() {
 	if(frame_screenshot_ and FileFinder().Exists(*frame_screenshot_))
 	{ return frame_screenshot_; }
 
-	unsigned index = 0;
 	std::string p;
 	do {
-		p = CreateScreenshotPath(index++);
+		p = CreateScreenshotPath(screenshot_index_++);
 	} while(FileFinder().Exists(p));
 	return frame_screenshot_ =
 			TakeScreenshot(p)? p : boost::optional<std::string>();
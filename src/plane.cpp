@@ -34,7 +34,7 @@ Plane::Plane() :
 }
 
 Plane::~Plane() {
-	Graphics().RemoveZObj(this);
+	Graphics().RemoveZObj(z, this);
 }
 
 void Plane::Draw(int /* z_order */) {
@@ -44,6 +44,13 @@ void Plane::Draw(int /* z_order */) {
 		bitmap->rect(), Graphics().ScreenBuffer()->rect(), ox, oy);
 }
 
+void Plane::GetDrawState(int /* z_order */, DrawState& state) const {
+	if (!bitmap) return;
+
+	bitmap_screen->GetDrawStateTiled(
+		bitmap->rect(), Graphics().ScreenBuffer()->rect(), ox, oy, state);
+}
+
 BitmapRef const& Plane::GetBitmap() const {
 	return bitmap;
 }
@@ -35,6 +35,9 @@
 namespace {
 
 mrb_state* current_vm_ = NULL;
+struct ModuleInternal;
+// internal() of current_vm_ without a VM lookup
+ModuleInternal* current_internal_ = NULL;
 
 struct ModuleInternal {
 	FontRef font;
@@ -45,10 +48,19 @@ struct ModuleInternal {
 	Output_ output;
 	mrb_state* const M;
 
-	ModuleInternal(mrb_state* vm) : font(Font::Shinonome()), M(vm) {}
+	// owned here and exposed to Ruby, so C++ reads them without calling the VM
+	bool exit_flag, reset_flag;
+	// updated by Game_System, empty until first set
+	std::string system_graphic;
+
+	ModuleInternal(mrb_state* vm)
+			: font(Font::Shinonome()), M(vm), exit_flag(false), reset_flag(false) {}
 
 	~ModuleInternal() {
-		if(current_vm_ == M) { current_vm_ = NULL; }
+		if(current_vm_ == M) {
+			current_vm_ = NULL;
+			current_internal_ = NULL;
+		}
 	}
 };
 
@@ -62,16 +74,49 @@ mrb_value get_player(mrb_state* M) {
 	return mrb_obj_value(mrb_class_get(M, "Player"));
 }
 
-ModuleInternal& internal(mrb_state* M) {
-	M = get_vm(M);
+ModuleInternal& lookup_internal(mrb_state* M) {
 	return EasyRPG::get<ModuleInternal>(
 		M, mrb_mod_cv_get(M, mrb_class_get(M, "Player"), mrb_intern_lit(M, "_module_internal")));
 }
 
+ModuleInternal& internal(mrb_state* M) {
+	if(not M or M == current_vm_) {
+		assert(current_internal_);
+		return *current_internal_;
+	}
+	return lookup_internal(M);
+}
+
+mrb_value get_exit_flag(mrb_state* M, mrb_value) {
+	return mrb_bool_value(internal(M).exit_flag);
+}
+mrb_value set_exit_flag(mrb_state* M, mrb_value) {
+	mrb_bool v;
+	mrb_get_args(M, "b", &v);
+	return internal(M).exit_flag = v, mrb_bool_value(v);
+}
+
+mrb_value get_reset_flag(mrb_state* M, mrb_value) {
+	return mrb_bool_value(internal(M).reset_flag);
+}
+mrb_value set_reset_flag(mrb_state* M, mrb_value) {
+	mrb_bool v;
+	mrb_get_args(M, "b", &v);
+	return internal(M).reset_flag = v, mrb_bool_value(v);
+}
+
+mrb_value set_system_graphic(mrb_state* M, mrb_value) {
+	char* str; int str_len;
+	mrb_get_args(M, "s", &str, &str_len);
+	internal(M).system_graphic.assign(str, str_len);
+	return mrb_nil_value();
+}
+
 }
 
 void Player::make_current(mrb_state* M) {
 	current_vm_ = M;
+	current_internal_ = M? &lookup_internal(M) : NULL;
 }
 mrb_state* Player::current_vm() { return current_vm_; }
 
@@ -90,6 +135,15 @@ void Player::register_player(mrb_state* M) {
 	new(ptr) ModuleInternal(M);
 
 	mrb_mod_cv_set(M, mrb_class_get(M, "Player"), mrb_intern_lit(M, "_module_internal"), mrb_obj_value(data));
+
+	static EasyRPG::method_info const methods[] = {
+		{ "exit_flag", &get_exit_flag, MRB_ARGS_NONE() },
+		{ "exit_flag=", &set_exit_flag, MRB_ARGS_REQ(1) },
+		{ "reset_flag", &get_reset_flag, MRB_ARGS_NONE() },
+		{ "reset_flag=", &set_reset_flag, MRB_ARGS_REQ(1) },
+		{ "system_graphic=", &set_system_graphic, MRB_ARGS_REQ(1) },
+		EasyRPG::method_info_end };
+	EasyRPG::define_module(M, "Player", methods);
 #ifdef MRB_DEBUG
 	mrb_gv_set(M, mrb_intern_lit(M, "$DEBUG"), mrb_true_value());
 #else
@@ -119,21 +173,17 @@ void Player::parse_args(mrb_value const& args, mrb_state* M) {
 }
 
 bool Player::exit_flag(mrb_state* M) {
-	M = get_vm(M);
-	return mrb_test(mrb_funcall(M, get_player(M), "exit_flag", 1));
+	return internal(M).exit_flag;
 }
 void Player::exit_flag(bool v, mrb_state* M) {
-	M = get_vm(M);
-	mrb_funcall(M, get_player(M), "exit_flag=", 1, mrb_bool_value(v));
+	internal(M).exit_flag = v;
 }
 
 bool Player::reset_flag(mrb_state* M) {
-	M = get_vm(M);
-	return mrb_test(mrb_funcall(M, get_player(M), "reset_flag", 0));
+	return internal(M).reset_flag;
 }
 void Player::reset_flag(bool v, mrb_state* M) {
-	M = get_vm(M);
-	mrb_funcall(M, get_player(M), "reset_flag=", 1, mrb_bool_value(v));
+	internal(M).reset_flag = v;
 }
 
 bool Player::window_flag(mrb_state* M) {
@@ -150,10 +200,18 @@ bool Player::is_rpg2k3(mrb_state* M) {
 	return mrb_test(mrb_funcall(M, get_player(M), "rpg2k3?", 0));
 }
 
-std::string Player::system_graphic(mrb_state* M) {
-	M = get_vm(M);
-	return EasyRPG::to_cxx_str(M, mrb_funcall(
-		M, mrb_obj_value(mrb_class_get(M, "Game_System")), "system_name", 0));
+std::string const& Player::system_graphic(mrb_state* M) {
+	ModuleInternal& i = internal(M);
+	if(i.system_graphic.empty()) {
+		// before Game_System notified a change
+		M = get_vm(M);
+		i.system_graphic = EasyRPG::to_cxx_str(M, mrb_funcall(
+			M, mrb_obj_value(mrb_class_get(M, "Game_System")), "system_name", 0));
+	}
+	return i.system_graphic;
+}
+void Player::system_graphic(std::string const& v, mrb_state* M) {
+	internal(M).system_graphic = v;
 }
 
 #define player_function(name)						\
@@ -41,7 +41,7 @@ Sprite::Sprite() :
 
 // Destructor
 Sprite::~Sprite() {
-	Graphics().RemoveZObj(this);
+	Graphics().RemoveZObj(z, this);
 }
 
 // Draw
@@ -51,6 +51,12 @@ void Sprite::Draw(int /* z_order */) {
 	bitmap_screen->BlitScreen(x - ox, y - oy, src_rect);
 }
 
+void Sprite::GetDrawState(int /* z_order */, DrawState& state) const {
+	if (GetWidth() <= 0 || GetHeight() <= 0) return;
+
+	bitmap_screen->GetDrawState(x - ox, y - oy, src_rect, state);
+}
+
 int Sprite::GetWidth() const {
 	return src_rect.width;
 }
@@ -27,9 +27,6 @@
 
 #include <cctype>
 
-#include <boost/next_prior.hpp>
-#include <boost/regex/pending/unicode_iterator.hpp>
-
 namespace {
 
 unsigned to_exfont_index(char const c) {
@@ -41,16 +38,14 @@ unsigned to_exfont_index(char const c) {
 	return ret;
 }
 
-typedef boost::u8_to_u32_iterator<std::string::const_iterator> u8_to_u32_iterator;
-
 }
 
 void Text::Draw(Bitmap& dest, int const x, int const y, std::string const& non_nfc_text, Text::Alignment align) {
 	if (non_nfc_text.empty()) return;
 
-	std::string const text = Utils::ToNfcString(non_nfc_text);
+	Font::LayoutRef const layout = dest.font->GetLayout(non_nfc_text);
 
-	Rect const text_size = dest.text_size(text);
+	Rect const text_size = layout->size;
 	Rect dst_rect = text_size;
 
 	switch (align) {
@@ -70,33 +65,26 @@ void Text::Draw(Bitmap& dest, int const x, int const y, std::string const& non_n
 
 	// This loops always renders a single char, color blends it and then puts
 	// it onto the text_surface (including the drop shadow)
-	for (u8_to_u32_iterator
-				 c(text.begin(), text.begin(), text.end()),
-				 end(text.end(), text.begin(), text.end()); c != end; ++c) {
-		u8_to_u32_iterator const next_c_it = boost::next(c);
-		uint32_t const next_c = std::distance(c, end) > 1? *next_c_it : 0;
+	for (std::vector<Font::Layout::Glyph>::const_iterator
+				 c = layout->glyphs.begin(); c != layout->glyphs.end(); ++c) {
+		int const glyph_x = dst_rect.x + c->x;
 
-		// ExFont-Detection: Check for A-Z or a-z behind the $
-		if (*c == '$' && std::isalpha(next_c)) {
-			unsigned const exfont_index = to_exfont_index(next_c);
+		// ExFont: A-Z or a-z behind the $
+		if (c->exfont) {
+			unsigned const exfont_index = to_exfont_index(c->code);
 
 			for(size_t font_y = 0; font_y < 12; ++font_y) {
 				for(size_t font_x = 0; font_x < 12; ++font_x) {
 					if(EASYRPG_EXFONT[exfont_index][font_y] & (0x01 << font_x)) {
 						// color
 						dest.set_pixel(
-							dst_rect.x + font_x, dst_rect.y + font_y,
+							glyph_x + font_x, dst_rect.y + font_y,
 							Font::default_color);
 					}
 				}
 			}
-
-			dst_rect.x += 12;
-			// Skip the alphabet part of exfont
-			++c;
 		} else { // Not ExFont, draw normal text
-			dest.font->Render(dest, dst_rect.x, dst_rect.y, *c);
-			dst_rect.x += dest.font->GetSize(*c).width;
+			dest.font->Render(dest, glyph_x, dst_rect.y, c->code);
 		}
 	}
 }
@@ -104,9 +92,9 @@ void Text::Draw(Bitmap& dest, int const x, int const y, std::string const& non_n
 void Text::Draw(Bitmap& dest, int x, int y, int color, std::string const& non_nfc_text, Text::Alignment align) {
 	if (non_nfc_text.empty()) return;
 
-	std::string const text = Utils::ToNfcString(non_nfc_text);
+	Font::LayoutRef const layout = dest.font->GetLayout(non_nfc_text);
 
-	Rect const text_size = dest.font->GetSize(text);
+	Rect const text_size = layout->size;
 	Rect dst_rect = text_size;
 
 	switch (align) {
@@ -132,15 +120,13 @@ void Text::Draw(Bitmap& dest, int x, int y, int color, std::string const& non_nf
 
 	// This loops always renders a single char, color blends it and then puts
 	// it onto the text_surface (including the drop shadow)
-	for (u8_to_u32_iterator
-				 c(text.begin(), text.begin(), text.end()),
-				 end(text.end(), text.begin(), text.end()); c != end; ++c) {
-		u8_to_u32_iterator const next_c_it = boost::next(c);
-		uint32_t const next_c = std::distance(c, end) > 1? *next_c_it : 0;
+	for (std::vector<Font::Layout::Glyph>::const_iterator
+				 c = layout->glyphs.begin(); c != layout->glyphs.end(); ++c) {
+		int const glyph_x = dst_rect.x + c->x;
 
-		// ExFont-Detection: Check for A-Z or a-z behind the $
-		if (*c == '$' && std::isalpha(next_c)) {
-			unsigned const exfont_index = to_exfont_index(next_c);
+		// ExFont: A-Z or a-z behind the $
+		if (c->exfont) {
+			unsigned const exfont_index = to_exfont_index(c->code);
 
 			size_t const color_base = (16 - 12) / 2;
 			unsigned const
@@ -153,22 +139,17 @@ void Text::Draw(Bitmap& dest, int x, int y, int color, std::string const& non_nf
 					if(EASYRPG_EXFONT[exfont_index][font_y] & (0x01 << font_x)) {
 						// color
 						dest.set_pixel(
-							dst_rect.x + font_x, dst_rect.y + font_y,
+							glyph_x + font_x, dst_rect.y + font_y,
 							system->get_pixel(src_x + font_x, src_y + font_y));
 						// shadow
 						dest.set_pixel(
-							dst_rect.x + font_x + 1, dst_rect.y + font_y + 1,
+							glyph_x + font_x + 1, dst_rect.y + font_y + 1,
 							system->get_pixel(shadow_x + font_x, shadow_y + font_y));
 					}
 				}
 			}
-
-			dst_rect.x += 12;
-			// Skip the alphabet part of exfont
-			++c;
 		} else { // Not ExFont, draw normal text
-			dest.font->Render(dest, dst_rect.x, dst_rect.y, *system, color, *c);
-			dst_rect.x += dest.font->GetSize(*c).width;
+			dest.font->Render(dest, glyph_x, dst_rect.y, *system, color, c->code);
 		}
 	}
 }
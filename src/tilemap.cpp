@@ -42,12 +42,18 @@ std::vector<int16_t> const& Tilemap::GetMapDataDown() const {
 void Tilemap::SetMapDataDown(std::vector<int16_t> const& down) {
 	layer_down.SetMapData(down);
 }
+void Tilemap::SetMapDataDown(MapDataRef const& down) {
+	layer_down.SetMapData(down);
+}
 std::vector<int16_t> const& Tilemap::GetMapDataUp() const {
 	return layer_up.GetMapData();
 }
 void Tilemap::SetMapDataUp(std::vector<int16_t> const& up) {
 	layer_up.SetMapData(up);
 }
+void Tilemap::SetMapDataUp(MapDataRef const& up) {
+	layer_up.SetMapData(up);
+}
 std::vector<uint8_t> const& Tilemap::GetPassableDown() const {
 	return layer_down.GetPassable();
 }
@@ -107,6 +113,13 @@ int Tilemap::GetAnimationType() const {
 void Tilemap::SetAnimationType(int type) {
 	layer_down.SetAnimationType(type);
 }
+bool Tilemap::GetChunked() const {
+	return layer_down.GetChunked();
+}
+void Tilemap::SetChunked(bool nchunked) {
+	layer_down.SetChunked(nchunked);
+	layer_up.SetChunked(nchunked);
+}
 void Tilemap::SubstituteDown(int old_id, int new_id) {
 	layer_down.Substitute(old_id, new_id);
 }
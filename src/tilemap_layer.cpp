@@ -16,9 +16,11 @@
  */
 
 // Headers
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 #include <boost/format.hpp>
+#include <boost/functional/hash.hpp>
 #include "tilemap_layer.h"
 #include "graphics.h"
 #include "output.h"
@@ -148,7 +150,10 @@ TilemapLayer::TilemapLayer(int ilayer) :
 	animation_step_c(0),
 	animation_speed(24),
 	animation_type(1),
-	layer(ilayer) {
+	layer(ilayer),
+	revision(0),
+	z_buckets_dirty(true),
+	chunked(false) {
 
 	chipset_screen = BitmapScreen::Create();
 
@@ -170,7 +175,11 @@ void TilemapLayer::DrawTile(BitmapScreen& screen, int x, int y, int row, int col
 	screen.BlitScreen(x, y, Rect(col * 16, row * 16, 16, 16));
 }
 
-void TilemapLayer::Draw(int z_order) {
+void TilemapLayer::UpdateZBuckets() {
+	for (z_buckets_type::iterator i = z_buckets.begin(); i != z_buckets.end(); ++i) {
+		i->second.clear();
+	}
+
 	// Get the number of tiles that can be displayed on window
 	int tiles_x = (int)ceil(Graphics().ScreenBuffer()->width() / 16.0);
 	int tiles_y = (int)ceil(Graphics().ScreenBuffer()->height() / 16.0);
@@ -193,11 +202,14 @@ void TilemapLayer::Draw(int z_order) {
 
 			if (width <= map_x || height <= map_y) continue;
 
-			int map_draw_x = x * 16 - ox % 16;
-			int map_draw_y = y * 16 - oy % 16;
-
 			// Get the tile data
-			TileData &tile = data_cache[map_x][map_y];
+			TileData const& tile = data_cache[map_x][map_y];
+
+			// Only block F is drawn on the upper layer
+			if (layer != 0 && !(tile.ID >= BLOCK_F && tile.ID < BLOCK_F + BLOCK_F_TILES)) continue;
+
+			// Baked into the chunks
+			if (chunked && tile.z == 0) continue;
 
 			int map_draw_z = tile.z;
 
@@ -208,77 +220,218 @@ void TilemapLayer::Draw(int z_order) {
 				}
 			}
 
-			// Draw the tile if its z is being draw now
-			if (z_order == map_draw_z) {
-				if (layer == 0) {
-					// If lower layer
-
-					if (tile.ID >= BLOCK_E && tile.ID < BLOCK_E + BLOCK_E_TILES) {
-						int id = substitutions[tile.ID - BLOCK_E];
-						// If Block E
-
-						int row, col;
-
-						// Get the tile coordinates from chipset
-						if (id < 96) {
-							// If from first column of the block
-							col = 12 + id % 6;
-							row = id / 6;
-						} else {
-							// If from second column of the block
-							col = 18 + (id - 96) % 6;
-							row = (id - 96) / 6;
-						}
-
-						DrawTile(*chipset_screen, map_draw_x, map_draw_y, row, col, false);
-					} else if (tile.ID >= BLOCK_C && tile.ID < BLOCK_D) {
-						// If Block C
-
-						// Get the tile coordinates from chipset
-						int col = 3 + (tile.ID - BLOCK_C) / 50;
-						int row = 4 + animation_step_c;
-
-						// Draw the tile
-						DrawTile(*chipset_screen, map_draw_x, map_draw_y, row, col, false);
-					} else if (tile.ID < BLOCK_C) {
-						// If Blocks A1, A2, B
-
-						// Draw the tile from autotile cache
-						TileXY pos = GetCachedAutotileAB(tile.ID, animation_step_ab);
-						DrawTile(*autotiles_ab_screen, map_draw_x, map_draw_y, pos.y, pos.x, true);
-					} else {
-						// If blocks D1-D12
+			TileDraw const draw = { x * 16 - ox % 16, y * 16 - oy % 16, tile.ID };
+			z_buckets[map_draw_z].push_back(draw);
+		}
+	}
 
-						// Draw the tile from autotile cache
-						TileXY pos = GetCachedAutotileD(tile.ID);
-						DrawTile(*autotiles_d_screen, map_draw_x, map_draw_y, pos.y, pos.x, true);
-					}
-				} else {
-					// If upper layer
-
-					// Check that block F is being drawn
-					if (tile.ID >= BLOCK_F && tile.ID < BLOCK_F + BLOCK_F_TILES) {
-						int id = substitutions[tile.ID - BLOCK_F];
-						int row, col;
-
-						// Get the tile coordinates from chipset
-						if (id < 48) {
-							// If from first column of the block
-							col = 18 + id % 6;
-							row = 8 + id / 6;
-						} else {
-							// If from second column of the block
-							col = 24 + (id - 48) % 6;
-							row = (id - 48) / 6;
-						}
-
-						// Draw the tile
-						DrawTile(*chipset_screen, map_draw_x, map_draw_y, row, col, false);
-					}
-				}
+	if (chunked) {
+		UpdateChunks();
+	}
+
+	z_buckets_dirty = false;
+}
+
+void TilemapLayer::Draw(int z_order) {
+	if (width <= 0 || height <= 0) return;
+
+	if (z_buckets_dirty) {
+		UpdateZBuckets();
+	}
+
+	if (chunked && z_order == 0) {
+		for (chunks_type::const_iterator i = chunks.begin(); i != chunks.end(); ++i) {
+			int const cx = i->first & 0xffff, cy = i->first >> 16;
+			i->second.screen->BlitScreen(cx * CHUNK_TILES * 16 - ox, cy * CHUNK_TILES * 16 - oy);
+		}
+	}
+
+	z_buckets_type::const_iterator const bucket = z_buckets.find(z_order);
+	if (bucket == z_buckets.end()) return;
+
+	for (std::vector<TileDraw>::const_iterator i = bucket->second.begin(); i != bucket->second.end(); ++i) {
+		DrawTileData(i->ID, i->x, i->y);
+	}
+}
+
+void TilemapLayer::GetDrawState(int /* z_order */, DrawState& state) const {
+	if (width <= 0 || height <= 0) return;
+
+	size_t seed = 0;
+	boost::hash_combine(seed, revision);
+	boost::hash_combine(seed, chipset.get());
+	boost::hash_combine(seed, chipset ? chipset->generation() : 0);
+	int const values[] = { ox, oy, animation_step_ab, animation_step_c };
+	boost::hash_range(seed, values, values + 4);
+
+	state.Add(Graphics().ScreenBuffer()->rect(), seed);
+}
+
+void TilemapLayer::DrawTileData(short ID, int map_draw_x, int map_draw_y) {
+	int row, col;
+	BitmapScreen* const screen = GetTileSource(ID, row, col);
+	if (screen) {
+		DrawTile(*screen, map_draw_x, map_draw_y, row, col, screen != chipset_screen.get());
+	}
+}
+
+BitmapScreen* TilemapLayer::GetTileSource(short ID, int& row, int& col) {
+	if (layer == 0) {
+		// If lower layer
+
+		if (ID >= BLOCK_E && ID < BLOCK_E + BLOCK_E_TILES) {
+			int id = substitutions[ID - BLOCK_E];
+			// If Block E
+
+			// Get the tile coordinates from chipset
+			if (id < 96) {
+				// If from first column of the block
+				col = 12 + id % 6;
+				row = id / 6;
+			} else {
+				// If from second column of the block
+				col = 18 + (id - 96) % 6;
+				row = (id - 96) / 6;
+			}
+
+			return chipset_screen.get();
+		} else if (ID >= BLOCK_C && ID < BLOCK_D) {
+			// If Block C
+
+			// Get the tile coordinates from chipset
+			col = 3 + (ID - BLOCK_C) / 50;
+			row = 4 + animation_step_c;
+
+			return chipset_screen.get();
+		} else if (ID < BLOCK_C) {
+			// If Blocks A1, A2, B
+
+			// Get the tile from autotile cache
+			TileXY pos = GetCachedAutotileAB(ID, animation_step_ab);
+			col = pos.x;
+			row = pos.y;
+
+			return autotiles_ab_screen.get();
+		} else {
+			// If blocks D1-D12
+
+			// Get the tile from autotile cache
+			TileXY pos = GetCachedAutotileD(ID);
+			col = pos.x;
+			row = pos.y;
+
+			return autotiles_d_screen.get();
+		}
+	} else {
+		// If upper layer
+
+		// Check that block F is being drawn
+		if (ID >= BLOCK_F && ID < BLOCK_F + BLOCK_F_TILES) {
+			int id = substitutions[ID - BLOCK_F];
+
+			// Get the tile coordinates from chipset
+			if (id < 48) {
+				// If from first column of the block
+				col = 18 + id % 6;
+				row = 8 + id / 6;
+			} else {
+				// If from second column of the block
+				col = 24 + (id - 48) % 6;
+				row = (id - 48) / 6;
+			}
+
+			return chipset_screen.get();
+		}
+	}
+
+	return NULL;
+}
+
+bool TilemapLayer::IsAnimated(short ID) const {
+	// Blocks A1, A2, B and C
+	return layer == 0 && ID < BLOCK_D;
+}
+
+void TilemapLayer::UpdateChunks() {
+	// Nothing to bake, the chunk range below would still cover one chunk
+	if (width <= 0 || height <= 0) {
+		chunks.clear();
+		return;
+	}
+
+	int const chunk_size = CHUNK_TILES * 16;
+	int const x0 = std::max(0, ox) / chunk_size;
+	int const y0 = std::max(0, oy) / chunk_size;
+	int const x1 = std::min((ox + (int)Graphics().ScreenBuffer()->width() - 1) / chunk_size,
+							(width - 1) / CHUNK_TILES);
+	int const y1 = std::min((oy + (int)Graphics().ScreenBuffer()->height() - 1) / chunk_size,
+							(height - 1) / CHUNK_TILES);
+
+	// Keep the chunks still visible, only render the newly exposed ones
+	chunks_type visible;
+	for (int cy = y0; cy <= y1; ++cy) {
+		for (int cx = x0; cx <= x1; ++cx) {
+			uint32_t const key = (uint32_t(cy) << 16) | uint32_t(cx);
+			Chunk& chunk = visible[key];
+
+			chunks_type::iterator const it = chunks.find(key);
+			if (it != chunks.end()) {
+				std::swap(chunk, it->second);
+			} else {
+				BakeChunk(cx, cy, chunk);
+			}
+		}
+	}
+	chunks.swap(visible);
+}
+
+void TilemapLayer::BakeChunk(int cx, int cy, Chunk& chunk) {
+	int const x0 = cx * CHUNK_TILES, y0 = cy * CHUNK_TILES;
+	int const w = std::min(CHUNK_TILES, width - x0);
+	int const h = std::min(CHUNK_TILES, height - y0);
+
+	BitmapRef const bmp = Bitmap::Create(w * 16, h * 16);
+	chunk.animated.clear();
+
+	for (int x = 0; x < w; x++) {
+		for (int y = 0; y < h; y++) {
+			TileData const& tile = data_cache[x0 + x][y0 + y];
+			if (tile.z != 0) continue;
+
+			int row, col;
+			BitmapScreen* const src = GetTileSource(tile.ID, row, col);
+			if (!src || !src->GetBitmap()) continue;
+
+			if (IsAnimated(tile.ID)) {
+				TileDraw const draw = { x * 16, y * 16, tile.ID };
+				chunk.animated.push_back(draw);
 			}
+			bmp->blit(x * 16, y * 16, *src->GetBitmap(), Rect(col * 16, row * 16, 16, 16), 255);
 		}
 	}
+
+	chunk.screen = BitmapScreen::Create(bmp);
+}
+
+void TilemapLayer::RefreshAnimatedChunks() {
+	for (chunks_type::iterator i = chunks.begin(); i != chunks.end(); ++i) {
+		Chunk& chunk = i->second;
+		if (chunk.animated.empty()) continue;
+
+		Bitmap& bmp = *chunk.screen->GetBitmap();
+		for (std::vector<TileDraw>::const_iterator t = chunk.animated.begin(); t != chunk.animated.end(); ++t) {
+			int row, col;
+			BitmapScreen* const src = GetTileSource(t->ID, row, col);
+			bmp.clear(Rect(t->x, t->y, 16, 16));
+			bmp.blit(t->x, t->y, *src->GetBitmap(), Rect(col * 16, row * 16, 16, 16), 255);
+		}
+		chunk.screen->SetDirty();
+	}
+}
+
+void TilemapLayer::InvalidateChunks() {
+	chunks.clear();
+	z_buckets_dirty = true;
 }
 
 TilemapLayer::TileXY TilemapLayer::GetCachedAutotileAB(short ID, short animID) {
@@ -487,6 +640,8 @@ BitmapScreenRef TilemapLayer::GenerateAutotiles(int count, autotiles_map_type co
 }
 
 void TilemapLayer::Update() {
+	char const old_step_ab = animation_step_ab, old_step_c = animation_step_c;
+
 	animation_frame += 1;
 
 	// Step to the next animation frame
@@ -511,6 +666,10 @@ void TilemapLayer::Update() {
 		animation_step_c = 0;
 		animation_frame = 0;
 	}
+
+	if (chunked && (old_step_ab != animation_step_ab || old_step_c != animation_step_c)) {
+		RefreshAnimatedChunks();
+	}
 }
 
 BitmapRef const& TilemapLayer::GetChipset() const {
@@ -520,12 +679,22 @@ void TilemapLayer::SetChipset(BitmapRef const& nchipset) {
 	chipset = nchipset;
 	chipset_screen->SetBitmap(chipset);
 	chipset_screen->SetSrcRect(chipset->rect());
+	InvalidateChunks();
+	++revision;
 }
 std::vector<int16_t> const& TilemapLayer::GetMapData() const {
-	return map_data;
+	static std::vector<int16_t> const empty;
+	return map_data ? *map_data : empty;
 }
 void TilemapLayer::SetMapData(std::vector<int16_t> const& nmap_data) {
-	if (map_data != nmap_data) {
+	if (map_data && *map_data == nmap_data) return;
+	SetMapData(std::make_shared<std::vector<int16_t> const>(nmap_data));
+}
+void TilemapLayer::SetMapData(MapDataRef const& nmap_ref) {
+	if (!nmap_ref) return;
+	std::vector<int16_t> const& nmap_data = *nmap_ref;
+
+	if (map_data != nmap_ref && (!map_data || *map_data != nmap_data)) {
 		// Create the tiles data cache
 		data_cache.resize(width);
 		for (int x = 0; x < width; x++) {
@@ -564,6 +733,8 @@ void TilemapLayer::SetMapData(std::vector<int16_t> const& nmap_data) {
 				data_cache[x][y] = tile;
 			}
 		}
+		InvalidateChunks();
+		++revision;
 
 		if (layer == 0) {
 			autotiles_ab_map.clear();
@@ -590,13 +761,14 @@ void TilemapLayer::SetMapData(std::vector<int16_t> const& nmap_data) {
 			autotiles_d_screen = GenerateAutotiles(autotiles_d_next, autotiles_d_map);
 		}
 	}
-	map_data = nmap_data;
+	map_data = nmap_ref;
 }
 std::vector<uint8_t> const& TilemapLayer::GetPassable() const {
 	return passable;
 }
 void TilemapLayer::SetPassable(std::vector<uint8_t> const& npassable) {
 	passable = npassable;
+	++revision;
 
 	if (substitutions.size() < passable.size())
 	{
@@ -610,24 +782,34 @@ int TilemapLayer::GetOx() const {
 	return ox;
 }
 void TilemapLayer::SetOx(int nox) {
+	if (ox != nox) z_buckets_dirty = true;
 	ox = nox;
 }
 int TilemapLayer::GetOy() const {
 	return oy;
 }
 void TilemapLayer::SetOy(int noy) {
+	if (oy != noy) z_buckets_dirty = true;
 	oy = noy;
 }
 int TilemapLayer::GetWidth() const {
 	return width;
 }
 void TilemapLayer::SetWidth(int nwidth) {
+	if (width != nwidth) {
+		z_buckets_dirty = true;
+		++revision;
+	}
 	width = nwidth;
 }
 int TilemapLayer::GetHeight() const {
 	return height;
 }
 void TilemapLayer::SetHeight(int nheight) {
+	if (height != nheight) {
+		z_buckets_dirty = true;
+		++revision;
+	}
 	height = nheight;
 }
 int TilemapLayer::GetAnimationSpeed() const {
@@ -647,6 +829,32 @@ int TilemapLayer::GetZ() const {
 	return -1;
 }
 
+bool TilemapLayer::GetChunked() const {
+	return chunked;
+}
+void TilemapLayer::SetChunked(bool nchunked) {
+	if (chunked == nchunked) return;
+
+	chunked = nchunked;
+	if (width <= 0 || height <= 0) return;
+	InvalidateChunks();
+}
+
 void TilemapLayer::Substitute(int old_id, int new_id) {
 	substitutions[old_id] = (uint8_t) new_id;
+
+	// Drop the chunks showing the substituted tile
+	int const base = layer == 0 ? BLOCK_E : BLOCK_F;
+	for (chunks_type::iterator i = chunks.begin(); i != chunks.end();) {
+		int const x0 = (i->first & 0xffff) * CHUNK_TILES, y0 = (i->first >> 16) * CHUNK_TILES;
+		bool found = false;
+		for (int x = x0; x < std::min(x0 + CHUNK_TILES, width) && !found; x++) {
+			for (int y = y0; y < std::min(y0 + CHUNK_TILES, height) && !found; y++) {
+				found = data_cache[x][y].ID - base == old_id;
+			}
+		}
+		i = found ? chunks.erase(i) : i + 1;
+	}
+	z_buckets_dirty = true;
+	++revision;
 }
@@ -24,6 +24,8 @@
 #include "window.h"
 #include "bitmap.h"
 
+#include <boost/functional/hash.hpp>
+
 Window::Window():
 	Drawable(TypeWindow),
 	stretch(true),
@@ -64,7 +66,7 @@ Window::Window():
 }
 
 Window::~Window() {
-	Graphics().RemoveZObj(this);
+	Graphics().RemoveZObj(z, this);
 }
 
 void Window::SetOpenAnimation(int frames) {
@@ -178,6 +180,36 @@ void Window::Draw(int /* z_order */) {
 	}
 }
 
+void Window::GetDrawState(int /* z_order */, DrawState& state) const {
+	if (width <= 0 || height <= 0) return;
+	if (x < -width || x > int(Graphics().ScreenBuffer()->width()) || y < -height || y > int(Graphics().ScreenBuffer()->height())) return;
+
+	bool const cursor_visible = windowskin && width > 16 && height > 16 &&
+		cursor_rect.width > 4 && cursor_rect.height > 4 && animation_frames == 0;
+
+	size_t seed = 0;
+	boost::hash_combine(seed, windowskin.get());
+	boost::hash_combine(seed, windowskin ? windowskin->generation() : 0);
+	boost::hash_combine(seed, contents.get());
+	boost::hash_combine(seed, contents ? contents->generation() : 0);
+
+	int const values[] = {
+		x, y, width, height, ox, oy, border_x, border_y,
+		opacity, back_opacity, contents_opacity, stretch,
+		cursor_visible, cursor_rect.x, cursor_rect.y, cursor_rect.width, cursor_rect.height,
+		cursor_visible && cursor_frame < 16,
+		pause && pause_frame > 16 && animation_frames <= 0, up_arrow, down_arrow,
+		// the open animation steps in Draw, so it must damage every frame
+		animation_frames, animation_frames > 0 ? int(animation_count) : 0 };
+	boost::hash_range(seed, values, values + sizeof(values) / sizeof(values[0]));
+
+	state.Add(Rect(x, y, width, height), seed);
+	if (cursor_visible) {
+		state.Add(Rect(x + cursor_rect.x + border_x, y + cursor_rect.y + border_y,
+					   cursor_rect.width, cursor_rect.height), seed);
+	}
+}
+
 void Window::RefreshBackground() {
 	background_needs_refresh = false;
 
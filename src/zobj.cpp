@@ -18,10 +18,35 @@
 // Headers
 #include "zobj.h"
 
+#include <algorithm>
+
+namespace {
+
+typedef ZList::Entry Entry;
+
+bool less_key(int lhs_z, uint32_t lhs_creation, int rhs_z, uint32_t rhs_creation) {
+	if (lhs_z != rhs_z) return lhs_z < rhs_z;
+	return lhs_creation < rhs_creation;
+}
+
+struct compare_entry {
+	bool operator()(Entry const& lhs, Entry const& rhs) const {
+		return less_key(lhs.z, lhs.creation, rhs.z, rhs.creation);
+	}
+};
+
+struct compare_z {
+	bool operator()(Entry const& lhs, int rhs) const { return lhs.z < rhs; }
+	bool operator()(int lhs, Entry const& rhs) const { return lhs < rhs.z; }
+};
+
+}
+
 ZObj::ZObj(int z, uint32_t creation, Drawable* ID)  :
 	z(z),
 	creation(creation),
-	ID(ID) {
+	ID(ID),
+	signature(0) {
 }
 
 void ZObj::SetZ(int nz) {
@@ -38,3 +63,117 @@ uint32_t ZObj::GetCreation() const {
 Drawable* ZObj::GetId() const {
 	return ID;
 }
+
+Rect const& ZObj::GetScreenRect() const {
+	return screen_rect;
+}
+void ZObj::SetScreenRect(Rect const& rect) {
+	screen_rect = rect;
+}
+
+size_t ZObj::GetSignature() const {
+	return signature;
+}
+void ZObj::SetSignature(size_t nsignature) {
+	signature = nsignature;
+}
+
+ZList::ZList() {}
+
+ZList::~ZList() {
+	for (auto const& i : data) {
+		delete i.zobj;
+	}
+}
+
+ZObj* ZList::Insert(int z, uint32_t creation, Drawable* id) {
+	std::unique_ptr<ZObj> obj(new ZObj(z, creation, id));
+	Entry const entry = { z, creation, obj.get() };
+
+	container_type::iterator const pos =
+		std::upper_bound(data.begin(), data.end(), entry, compare_entry());
+	data.insert(pos, entry);
+	return obj.release();
+}
+
+std::unique_ptr<ZObj> ZList::Remove(int z, Drawable* id) {
+	std::pair<container_type::iterator, container_type::iterator> const range =
+		std::equal_range(data.begin(), data.end(), z, compare_z());
+
+	for (container_type::iterator i = range.first; i != range.second; ++i) {
+		if (i->zobj->GetId() == id) {
+			std::unique_ptr<ZObj> ret(i->zobj);
+			data.erase(i);
+			return ret;
+		}
+	}
+
+	// z may be stale when it changed while the ZObj was in a pushed state
+	for (container_type::iterator i = data.begin(); i != data.end(); ++i) {
+		if (i->zobj->GetId() == id) {
+			std::unique_ptr<ZObj> ret(i->zobj);
+			data.erase(i);
+			return ret;
+		}
+	}
+	return std::unique_ptr<ZObj>();
+}
+
+void ZList::Remove(Drawable* id) {
+	// unlike remove_if, keeps the removed entries to delete them
+	container_type::iterator const end = std::stable_partition(
+		data.begin(), data.end(), [id](Entry const& i) { return i.zobj->GetId() != id; });
+	for (container_type::iterator i = end; i != data.end(); ++i) {
+		delete i->zobj;
+	}
+	data.erase(end, data.end());
+}
+
+bool ZList::Update(ZObj* zobj, int z) {
+	container_type::iterator const it = Find(zobj);
+	zobj->SetZ(z);
+	if (it == data.end()) return false;
+
+	it->z = z;
+	compare_entry const less;
+	if (it + 1 != data.end() && less(*(it + 1), *it)) {
+		// z increased
+		container_type::iterator const pos = std::upper_bound(it + 1, data.end(), *it, less);
+		std::rotate(it, it + 1, pos);
+	} else if (it != data.begin() && less(*it, *(it - 1))) {
+		// z decreased
+		container_type::iterator const pos = std::upper_bound(data.begin(), it, *it, less);
+		std::rotate(pos, it, it + 1);
+	}
+	return true;
+}
+
+ZList::container_type::iterator ZList::Find(ZObj const* zobj) {
+	int const z = zobj->GetZ();
+	uint32_t const creation = zobj->GetCreation();
+
+	container_type::iterator i = std::lower_bound(
+		data.begin(), data.end(), zobj, [z, creation](Entry const& lhs, ZObj const*) {
+			return less_key(lhs.z, lhs.creation, z, creation);
+		});
+	// multi z drawables share the key
+	for (; i != data.end() && i->z == z && i->creation == creation; ++i) {
+		if (i->zobj == zobj) return i;
+	}
+
+	// entry z is stale when the ZObj changed z while its state was pushed
+	return std::find_if(data.begin(), data.end(),
+		[zobj](Entry const& e) { return e.zobj == zobj; });
+}
+
+ZList::const_iterator ZList::begin() const {
+	return data.begin();
+}
+
+ZList::const_iterator ZList::end() const {
+	return data.end();
+}
+
+size_t ZList::size() const {
+	return data.size();
+}
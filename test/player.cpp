@@ -1,4 +1,6 @@
 #include <ciso646>
+#include <algorithm>
+#include <vector>
 
 #include "utils.h"
 #include "filefinder.h"
@@ -6,6 +8,7 @@
 #include "font.h"
 #include "rect.h"
 #include "output.h"
+#include "zobj.h"
 
 #include "binding.hxx"
 
@@ -39,6 +42,22 @@ void CheckSize(mrb_state* M) {
 	easyrpg_assert(f.GetSize("Hello World!").width == 6 * 12);
 }
 
+void CheckLayout(mrb_state* M) {
+	Font const& f = *Font::Default();
+
+	// exfont icon and "$$" are two glyphs when drawn
+	Font::LayoutRef const l = f.GetLayout("$a$$b");
+	easyrpg_assert(l->glyphs.size() == 4);
+	easyrpg_assert(l->glyphs[0].exfont and l->glyphs[0].code == 'a');
+	easyrpg_assert(not l->glyphs[1].exfont and l->glyphs[1].x == 12);
+	easyrpg_assert(l->size == f.GetSize("$a$$b"));
+	// cached until evicted
+	easyrpg_assert(f.GetLayout("$a$$b") == l);
+
+	// decomposed "\u304b\u3099" is normalized to one glyph
+	easyrpg_assert(f.GetLayout("\xe3\x81\x8b\xe3\x82\x99")->glyphs.size() == 1);
+}
+
 void CheckIsRPG2kProject(mrb_state* M) {
 	std::shared_ptr<FileFinder_::ProjectTree> const
 			tree = FileFinder(M).CreateProjectTree(getenv("RPG_TEST_GAME_PATH"));
@@ -53,6 +72,58 @@ void CheckEnglishFilename(mrb_state* M) {
 	easyrpg_assert(not FileFinder(M).FindImage("Backdrop", "castle").empty());
 }
 
+Drawable* ZListId(std::vector<char>& ids, int i) {
+	return reinterpret_cast<Drawable*>(&ids[i]);
+}
+
+bool IsOrdered(ZList const& zlist) {
+	return std::is_sorted(
+		zlist.begin(), zlist.end(), [](ZList::Entry const& lhs, ZList::Entry const& rhs) {
+			return lhs.z < rhs.z || (lhs.z == rhs.z && lhs.creation < rhs.creation);
+		});
+}
+
+void ZListOrder(mrb_state* M) {
+	std::vector<char> ids(4);
+	ZList zlist;
+
+	ZObj* const a = zlist.Insert(10, 0, ZListId(ids, 0));
+	ZObj* const b = zlist.Insert(5, 1, ZListId(ids, 1));
+	ZObj* const c = zlist.Insert(10, 2, ZListId(ids, 2));
+	zlist.Insert(20, 3, ZListId(ids, 3));
+	zlist.Insert(30, 3, ZListId(ids, 3));
+	easyrpg_assert(zlist.size() == 5);
+	easyrpg_assert(IsOrdered(zlist));
+	easyrpg_assert(zlist.begin()->zobj == b);
+
+	// reorder both ways
+	easyrpg_assert(zlist.Update(b, 15));
+	easyrpg_assert(IsOrdered(zlist));
+	easyrpg_assert(zlist.begin()->zobj == a);
+	easyrpg_assert(zlist.Update(c, 0));
+	easyrpg_assert(IsOrdered(zlist));
+	easyrpg_assert(zlist.begin()->zobj == c && c->GetZ() == 0);
+
+	// z changed while not in this list (pushed state), entry z is stale
+	ZList other;
+	easyrpg_assert(not other.Update(a, 25));
+	easyrpg_assert(a->GetZ() == 25);
+	easyrpg_assert(zlist.Update(a, 26));
+	easyrpg_assert(IsOrdered(zlist));
+	easyrpg_assert(not other.Update(c, 40));
+	std::unique_ptr<ZObj> const removed_c = zlist.Remove(c->GetZ(), ZListId(ids, 2));
+	easyrpg_assert(removed_c.get() == c);
+	easyrpg_assert(zlist.size() == 4);
+
+	std::unique_ptr<ZObj> const removed_b = zlist.Remove(15, ZListId(ids, 1));
+	easyrpg_assert(removed_b.get() == b);
+	easyrpg_assert(not zlist.Remove(15, ZListId(ids, 1)));
+
+	// every ZObj of a multi z drawable
+	zlist.Remove(ZListId(ids, 3));
+	easyrpg_assert(zlist.size() == 1 && zlist.begin()->zobj == a);
+}
+
 }
 
 extern "C" void mrb_EasyRPG_Player_gem_test(mrb_state* M) {
@@ -65,7 +136,9 @@ extern "C" void mrb_EasyRPG_Player_gem_test(mrb_state* M) {
 	LowerCase(M);
 	GetExt(M);
 	CheckSize(M);
+	CheckLayout(M);
 	CheckIsDirectory(M);
 	CheckIsRPG2kProject(M);
 	CheckEnglishFilename(M);
+	ZListOrder(M);
 }
@@ -245,6 +245,10 @@ void SdlUi::ProcessEvents() {
 }
 
 void SdlUi::UpdateDisplay() {
+	UpdateDisplay(Graphics().ScreenBuffer()->rect());
+}
+
+void SdlUi::UpdateDisplay(Rect const& rect) {
 	BitmapRef const& bmp = Graphics().ScreenBuffer();
 
 	uint32_t const texture_format =
@@ -252,17 +256,24 @@ void SdlUi::UpdateDisplay() {
 			? SDL_PIXELFORMAT_ABGR8888
 			: SDL_PIXELFORMAT_RGBA8888;
 
+	Rect update_rect = rect;
 	if(not screen_) {
 		screen_.reset(SDL_CreateTexture(
 			renderer_.get(), texture_format, SDL_TEXTUREACCESS_STREAMING,
 			bmp->width(), bmp->height()), &SDL_DestroyTexture);
+		update_rect = bmp->rect();
 	}
 
-	SDL_Rect src_rect;
-	src_rect.x = 0; src_rect.y = 0; src_rect.w = bmp->width(); src_rect.h = bmp->height();
+	// only upload the changed area
+	if(not update_rect.IsEmpty()) {
+		SDL_Rect src_rect;
+		src_rect.x = update_rect.x; src_rect.y = update_rect.y;
+		src_rect.w = update_rect.width; src_rect.h = update_rect.height;
 
-	SDL_UpdateTexture(
-		screen_.get(), &src_rect, &bmp->get_pixel(0, 0), sizeof(Color) * bmp->width());
+		SDL_UpdateTexture(
+			screen_.get(), &src_rect, &bmp->get_pixel(update_rect.x, update_rect.y),
+			sizeof(Color) * bmp->width());
+	}
 	SDL_RenderClear(renderer_.get());
 	SDL_RenderCopy(renderer_.get(), screen_.get(), NULL, NULL);
 	SDL_RenderPresent(renderer_.get());
@@ -57,6 +57,7 @@ public:
 	bool IsZoomed() const;
 	void SetZoom(bool z);
 	void UpdateDisplay();
+	void UpdateDisplay(Rect const& rect);
 	void SetTitle(const std::string &title);
 
 	void ShowCursor(bool flag);
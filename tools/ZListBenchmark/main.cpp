@@ -0,0 +1,116 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "zobj.h"
+
+namespace {
+
+bool LessZObj(std::unique_ptr<ZObj> const& lhs, std::unique_ptr<ZObj> const& rhs) {
+	if (lhs->GetZ() != rhs->GetZ()) return lhs->GetZ() < rhs->GetZ();
+	return lhs->GetCreation() < rhs->GetCreation();
+}
+
+}
+
+// compares ZList with the former std::list + sort z-list
+int main() {
+	int const counts[] = { 1000, 10000 };
+	int const frames = 60;
+
+	for (int const count : counts) {
+		std::vector<char> ids(count);
+		std::vector<int> initial_z(count);
+		std::mt19937 rng(count);
+		for (int i = 0; i < count; ++i) {
+			initial_z[i] = rng() % 240;
+		}
+
+		typedef std::chrono::steady_clock clock;
+		typedef std::chrono::duration<double, std::milli> msec;
+
+		// former z-list
+		std::list<std::unique_ptr<ZObj> > list;
+		std::vector<ZObj*> list_objs;
+		rng.seed(count);
+		clock::time_point const list_start = clock::now();
+		for (int i = 0; i < count; ++i) {
+			list.push_back(std::unique_ptr<ZObj>(
+				new ZObj(initial_z[i], i, reinterpret_cast<Drawable*>(&ids[i]))));
+			list_objs.push_back(list.back().get());
+		}
+		list.sort(LessZObj);
+		for (int f = 0; f < frames; ++f) {
+			// characters moving a row
+			for (int i = 0; i < count / 20; ++i) {
+				ZObj* const obj = list_objs[rng() % count];
+				obj->SetZ(obj->GetZ() + (rng() % 2 ? 16 : -16));
+			}
+			list.sort(LessZObj);
+		}
+		double const list_time = msec(clock::now() - list_start).count();
+
+		// sorted array
+		ZList zlist;
+		std::vector<ZObj*> zlist_objs;
+		rng.seed(count);
+		clock::time_point const zlist_start = clock::now();
+		for (int i = 0; i < count; ++i) {
+			zlist_objs.push_back(zlist.Insert(initial_z[i], i, reinterpret_cast<Drawable*>(&ids[i])));
+		}
+		for (int f = 0; f < frames; ++f) {
+			for (int i = 0; i < count / 20; ++i) {
+				ZObj* const obj = zlist_objs[rng() % count];
+				zlist.Update(obj, obj->GetZ() + (rng() % 2 ? 16 : -16));
+			}
+		}
+		double const zlist_time = msec(clock::now() - zlist_start).count();
+
+		// both must give the same drawing order
+		assert(zlist.size() == list.size());
+		assert(std::equal(
+			list.begin(), list.end(), zlist.begin(),
+			[](std::unique_ptr<ZObj> const& lhs, ZList::Entry const& rhs) {
+				return lhs->GetZ() == rhs.z && lhs->GetCreation() == rhs.creation;
+			}));
+
+		for (int i = 0; i < count; i += 2) {
+			std::unique_ptr<ZObj> const removed =
+				zlist.Remove(zlist_objs[i]->GetZ(), zlist_objs[i]->GetId());
+			assert(removed);
+			(void)removed;
+		}
+		assert(int(zlist.size()) == count - (count + 1) / 2);
+		assert(std::is_sorted(
+			zlist.begin(), zlist.end(), [](ZList::Entry const& lhs, ZList::Entry const& rhs) {
+				return lhs.z < rhs.z || (lhs.z == rhs.z && lhs.creation < rhs.creation);
+			}));
+
+		std::printf("z-list %d drawables, %d frames: list %.3fms, ZList %.3fms\n",
+					count, frames, list_time, zlist_time);
+	}
+	return EXIT_SUCCESS;
+}
+